@@ -0,0 +1,85 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Benchmark of a typical parsing loop, compiled once per way of bringing
+// the core into a program (see bench/CMakeLists.txt): split (the source
+// files compiled on their own) and header-only. Both are compiled with the
+// same flags, so the differences between them come from what the compiler
+// can inline into the loop.
+
+// Usage: readpars_inlining_<build> [nlines] [nrepeats]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "readpars.hpp"
+
+// Name of the build being measured
+#ifndef READPARS_BENCH_CONFIG
+#define READPARS_BENCH_CONFIG "split"
+#endif
+
+// Compiler flags of the build (the same for every build)
+#ifndef READPARS_BENCH_FLAGS
+#define READPARS_BENCH_FLAGS ""
+#endif
+
+int main(int argc, char *argv[]) {
+
+    // Size of the benchmark
+    const size_t nlines = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000u;
+    const size_t nrepeats = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20u;
+    const size_t nvalues = 8u;
+
+    // Parameter file laid out in memory (so the disk is left out)
+    std::string text;
+    for (size_t i = 0u; i < nlines; ++i) {
+        text += "par" + std::to_string(i);
+        for (size_t j = 0u; j < nvalues; ++j) text += " " + std::to_string(0.001 * static_cast<double>(i + j));
+        text += "\n";
+    }
+
+    // Best time over the repeats
+    double best = 1e300;
+    double total = 0.0;
+    std::vector<double> values;
+
+    // For each repeat...
+    for (size_t r = 0u; r < nrepeats; ++r) {
+
+        // Start the clock
+        const auto start = std::chrono::steady_clock::now();
+
+        // Read every line
+        ReadPars reader("benchmark.txt");
+        reader.open(text);
+        while (!reader.iseof()) {
+            reader.readline();
+            reader.readvalues<double>(values, nvalues);
+            total += values[0u];
+        }
+
+        // Stop the clock
+        const std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+        best = std::min(best, time.count());
+
+    }
+
+    // Report (the total keeps the loop from being optimized away)
+    std::printf("%-12s %8.1f ns/line %8.2f ns/value (checksum %g, flags \"%s\")\n", READPARS_BENCH_CONFIG, best / nlines, best / (nlines * nvalues), total, READPARS_BENCH_FLAGS);
+
+    return 0;
+
+}
@@ -0,0 +1,324 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Microbenchmarks of the functions of the reader that run once per line or
+// once per value. Each benchmark reads text laid out in memory (so the disk
+// is left out), and reports the time per operation, the amount of text
+// read per second and the number of memory allocations per operation.
+
+// Usage: readpars_bench [--json output.json] [--baseline baseline.json]
+//                       [--tolerance 0.2] [--max 10000000]
+//
+// With --json, results are saved in a file (one benchmark per line), which
+// can be kept as a baseline. With --baseline, results are compared to those
+// of a previous run, and benchmarks slower by more than the tolerance (as a
+// proportion, 20% by default, as timings vary from run to run) are flagged,
+// in which case the program exits with an error.
+// With --max, the largest number of values per line is set (up to 10^7).
+
+#include "readpars.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Number of memory allocations made so far
+static std::atomic<size_t> nallocs(0u);
+
+// Count every allocation
+void* operator new(size_t size) {
+    ++nallocs;
+    if (void *p = std::malloc(size ? size : 1u)) return p;
+    throw std::bad_alloc();
+}
+
+// Release (sized or not)
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+    // Result of a benchmark
+    struct Result {
+
+        std::string name;
+        double nsop;
+        double bytess;
+        double allocsop;
+
+    };
+
+    // Results so far
+    std::vector<Result> results;
+
+    // Something to keep the compiler from optimizing reads away
+    double sink = 0.0;
+
+    // Function to time a benchmark
+    template <typename F>
+    void measure(const std::string &name, const std::string &text, const size_t &nops, const F &run) {
+
+        // name: name of the benchmark
+        // text: text read at each run
+        // nops: number of operations per run
+        // run: function reading the text once
+
+        // Note: The best of several runs is kept (at least five, and as many
+        // as fit in about a fifth of a second).
+
+        // Prepare
+        double best = 1e300;
+        size_t allocs = 0u;
+        double spent = 0.0;
+
+        // For each run...
+        for (size_t r = 0u; r < 5u || (spent < 2e8 && r < 1000u); ++r) {
+
+            // Run and time it
+            const size_t before = nallocs;
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+
+            // Record
+            best = std::min(best, time.count());
+            allocs = nallocs - before;
+            spent += time.count();
+
+        }
+
+        // Save
+        results.push_back({ name, best / nops, 1e9 * text.size() / best, static_cast<double>(allocs) / nops });
+
+    }
+
+    // Function to lay out a parameter file in memory
+    std::string layout(const size_t &nlines, const size_t &nvalues, const std::string &value) {
+
+        // nlines: number of lines
+        // nvalues: number of values per line
+        // value: value to write
+
+        // Prepare
+        std::string text;
+        text.reserve(nlines * (8u + nvalues * (value.size() + 1u)));
+
+        // Write
+        for (size_t i = 0u; i < nlines; ++i) {
+            text += "par";
+            for (size_t j = 0u; j < nvalues; ++j) { text += ' '; text += value; }
+            text += '\n';
+        }
+
+        return text;
+
+    }
+
+    // Function to benchmark reading one value per line into a given type
+    template <typename T>
+    void benchvalue(const std::string &type, const std::string &value) {
+
+        // type: name of the type
+        // value: value written on each line
+
+        // One value per line
+        const size_t nlines = 100000u;
+        const std::string text = layout(nlines, 1u, value);
+
+        // Read them all
+        measure("readvalue<" + type + ">", text, nlines, [&] {
+            ReadPars reader("bench");
+            reader.open(text);
+            T x;
+            while (!reader.iseof()) { reader.readline(); reader.readvalue<T>(x); }
+            if constexpr (std::is_arithmetic_v<T>) sink += static_cast<double>(x);
+        });
+    }
+
+    // Function to read results saved by an earlier run
+    std::vector<Result> load(const std::string &filename) {
+
+        // filename: name of the file
+
+        // Open it
+        std::FILE *file = std::fopen(filename.c_str(), "r");
+        if (!file) throw std::runtime_error("Unable to open file " + filename);
+
+        // Prepare
+        std::vector<Result> saved;
+        char buffer[1024];
+
+        // One benchmark per line, as written by save() below
+        while (std::fgets(buffer, sizeof buffer, file)) {
+
+            Result result;
+            char name[256];
+            if (std::sscanf(buffer, " {\"name\": \"%255[^\"]\", \"ns_per_op\": %lf, \"bytes_per_s\": %lf, \"allocs_per_op\": %lf",
+                name, &result.nsop, &result.bytess, &result.allocsop) != 4) continue;
+            result.name = name;
+            saved.push_back(result);
+
+        }
+
+        // Close the file
+        std::fclose(file);
+
+        return saved;
+
+    }
+
+    // Function to save the results
+    void save(const std::string &filename) {
+
+        // filename: name of the file
+
+        // Open it
+        std::FILE *file = std::fopen(filename.c_str(), "w");
+        if (!file) throw std::runtime_error("Unable to open file " + filename);
+
+        // One benchmark per line
+        std::fprintf(file, "[\n");
+        for (size_t i = 0u; i < results.size(); ++i)
+            std::fprintf(file, "  {\"name\": \"%s\", \"ns_per_op\": %.3f, \"bytes_per_s\": %.0f, \"allocs_per_op\": %.3f}%s\n",
+                results[i].name.c_str(), results[i].nsop, results[i].bytess, results[i].allocsop, i + 1u < results.size() ? "," : "");
+        std::fprintf(file, "]\n");
+
+        // Close the file
+        std::fclose(file);
+
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    // Options
+    std::string output = "";
+    std::string baseline = "";
+    double tolerance = 0.2;
+    size_t max = 10000000u;
+
+    // Read them
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--json")) output = argv[i + 1];
+        else if (!std::strcmp(argv[i], "--baseline")) baseline = argv[i + 1];
+        else if (!std::strcmp(argv[i], "--tolerance")) tolerance = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--max")) max = std::strtoul(argv[i + 1], nullptr, 10);
+        else { std::fprintf(stderr, "Unknown option %s\n", argv[i]); return 1; }
+    }
+
+    // Reading lines (name and one value, not read)
+    {
+        const size_t nlines = 100000u;
+        const std::string text = layout(nlines, 1u, "1");
+        measure("readline", text, nlines, [&] {
+            ReadPars reader("bench");
+            reader.open(text);
+            while (!reader.iseof()) reader.readline();
+            sink += reader.getcount();
+        });
+    }
+
+    // Splitting lines into words (taken as they are, without conversion)
+    {
+        const size_t nlines = 10000u;
+        const std::string text = layout(nlines, 10u, "abc");
+        measure("readnext (words)", text, nlines * 10u, [&] {
+            ReadPars reader("bench");
+            reader.open(text);
+            std::vector<std::string> words;
+            while (!reader.iseof()) { reader.readline(); reader.readall<std::string>(words); }
+            sink += words.size();
+        });
+    }
+
+    // Converting values into each type
+    benchvalue<double>("double", "0.0125");
+    benchvalue<int>("int", "-42");
+    benchvalue<unsigned>("unsigned", "42");
+    benchvalue<size_t>("size_t", "1000000");
+    benchvalue<bool>("bool", "1");
+    benchvalue<std::string>("string", "abc");
+
+    // Reading vectors of increasing sizes (time per value)
+    for (size_t n = 1u; n <= max; n *= 10u) {
+        const size_t nlines = std::max(size_t(1u), 100000u / n);
+        const std::string text = layout(nlines, n, "0.5");
+        measure("readvalues<double> x" + std::to_string(n), text, nlines * n, [&] {
+            ReadPars reader("bench");
+            reader.open(text);
+            std::vector<double> values;
+            while (!reader.iseof()) { reader.readline(); reader.readvalues<double>(values, n); }
+            sink += values.back();
+        });
+    }
+
+    // Dispatching checks (none, then a function checking each value)
+    {
+        const size_t nlines = 100000u;
+        const std::string text = layout(nlines, 1u, "0.5");
+        const std::function<std::string(const double&)> check = [](const double &x) { return x >= 0.0 && x <= 1.0 ? "" : "must be between 0 and 1"; };
+        measure("readvalue<double> unchecked", text, nlines, [&] {
+            ReadPars reader("bench");
+            reader.open(text);
+            double x;
+            while (!reader.iseof()) { reader.readline(); reader.readvalue<double>(x); }
+            sink += x;
+        });
+        measure("readvalue<double> checked", text, nlines, [&] {
+            ReadPars reader("bench");
+            reader.open(text);
+            double x;
+            while (!reader.iseof()) { reader.readline(); reader.readvalue<double>(x, check); }
+            sink += x;
+        });
+    }
+
+    // Earlier results, if any
+    const std::vector<Result> saved = baseline.empty() ? std::vector<Result>() : load(baseline);
+    bool slower = false;
+
+    // Report
+    std::printf("%-30s %12s %14s %12s %10s\n", "benchmark", "ns/op", "MB/s", "allocs/op", "change");
+    for (const Result &result : results) {
+
+        // Matching earlier result
+        const auto it = std::find_if(saved.begin(), saved.end(), [&](const Result &r) { return r.name == result.name; });
+
+        // Relative change in time
+        std::string change = "";
+        if (it != saved.end()) {
+            const double ratio = result.nsop / it->nsop - 1.0;
+            char buffer[32];
+            std::snprintf(buffer, sizeof buffer, "%+.1f%%%s", 100.0 * ratio, ratio > tolerance ? " !" : "");
+            change = buffer;
+            slower = slower || ratio > tolerance;
+        }
+
+        std::printf("%-30s %12.2f %14.1f %12.3f %10s\n", result.name.c_str(), result.nsop, result.bytess / 1e6, result.allocsop, change.c_str());
+
+    }
+
+    // Save, if needed
+    if (!output.empty()) save(output);
+
+    // Keep the reads
+    if (sink == 0.12345) std::printf("\n");
+
+    return slower ? 1 : 0;
+
+}
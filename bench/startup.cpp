@@ -0,0 +1,275 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// End-to-end benchmark of the time a program takes to read its parameters,
+// as done in doMain() (see src/MAIN.cpp): create a reader, open the file,
+// read each line, dispatch on the name, check the values and close. It runs
+// over batches of files, from 1 to 100,000 by default (the powers of ten
+// below the largest batch, and the largest batch itself), once with the
+// files out of the page cache of the system (cold, as when a job launcher
+// starts many short jobs) and once with the files in it (warm), and reports
+// the median (p50) and 99th percentile (p99) of the time per file.
+
+// Usage: readpars_startup [--max 100000] [--dir startup_files]
+
+// Note: Files are put out of the cache with posix_fadvise(POSIX_FADV_DONTNEED),
+// which the system may not fully honour (e.g. on some file systems or in
+// containers), so cold timings are a best effort. They are skipped where the
+// call does not exist.
+
+#include "readpars.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    // Checks, as in doMain()
+    template <typename T>
+    std::string checkpositive(const T &x) { return x >= 0.0 ? "" : "must be positive"; }
+    template <typename T>
+    std::string checkstrictpos(const T &x) { return x > 0.0 ? "" : "must be strictly positive"; }
+    template <typename T>
+    std::string checkprop(const T &x) { return x >= 0.0 && x <= 1.0 ? "" : "must be between zero and one"; }
+
+    // Something to keep the compiler from optimizing reads away
+    double sink = 0.0;
+
+    // Function to read a parameter file the way doMain() does
+    void domain(const std::string &filename) {
+
+        // filename: name of the file
+
+        // Declare containers
+        int ngenes = 0;
+        double mutrate = 0.0;
+        double noise = 0.0;
+        std::vector<double> genes;
+
+        // Initialize a reader
+        ReadPars r(filename);
+
+        // Open the file
+        r.open();
+
+        // For each line in the file...
+        while (!r.iseof()) {
+
+            // Read a line
+            r.readline();
+
+            // Skip empty and comment lines
+            if (r.isempty() || r.iscomment()) continue;
+
+            // Current parameter name
+            std::string name = r.getname();
+
+            // Read the parameter value(s)
+            if (name == "ngenes") r.readvalue<int>(ngenes, checkstrictpos<int>);
+            else if (name == "mutrate") r.readvalue<double>(mutrate, checkprop<double>);
+            else if (name == "noise") r.readvalue<double>(noise, checkpositive<double>);
+            else if (name == "genes") r.readvalues<double>(genes, ngenes, checkstrictpos<double>);
+            else r.readerror();
+
+        }
+
+        // Close the file
+        r.close();
+
+        // Use the values
+        sink += mutrate + noise + genes.back();
+
+    }
+
+    // Function to write a parameter file like those read by doMain()
+    void write(const std::string &filename, const size_t &k) {
+
+        // filename: name of the file
+        // k: number of the file (values change from file to file)
+
+        // Content
+        const size_t ngenes = 5u + k % 20u;
+        std::string text = "# Parameters of run " + std::to_string(k) + "\n\n";
+        text += "ngenes " + std::to_string(ngenes) + "\n";
+        text += "mutrate 0.00" + std::to_string(1u + k % 9u) + "\n";
+        text += "noise " + std::to_string(k % 7u) + ".5\n";
+        text += "genes";
+        for (size_t i = 0u; i < ngenes; ++i) text += " " + std::to_string(1u + (k + i) % 97u) + ".25";
+        text += "\n";
+
+        // Open the file
+        std::FILE *file = std::fopen(filename.c_str(), "wb");
+        if (!file) throw std::runtime_error("Unable to open file " + filename);
+
+        // Write it (a full disk would otherwise leave files cut short)
+        bool ok = std::fwrite(text.data(), 1u, text.size(), file) == text.size();
+        ok = std::fclose(file) == 0 && ok;
+        if (!ok) throw std::runtime_error("Unable to write file " + filename);
+
+    }
+
+    // Function to put a file out of the page cache
+    bool evict(const std::string &filename) {
+
+        // filename: name of the file
+
+#if !defined(_WIN32) && defined(POSIX_FADV_DONTNEED)
+
+        // Write back anything pending, then drop the pages
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        ::fdatasync(fd);
+        const bool ok = ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        ::close(fd);
+        return ok;
+
+#else
+
+        // Not available
+        (void)filename;
+        return false;
+
+#endif
+
+    }
+
+    // Function to time the reading of a batch of files
+    std::vector<double> time(const std::vector<std::string> &filenames) {
+
+        // filenames: files to read
+
+        // Prepare
+        std::vector<double> times;
+        times.reserve(filenames.size());
+
+        // Time each file
+        for (const std::string &filename : filenames) {
+            const auto start = std::chrono::steady_clock::now();
+            domain(filename);
+            const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            times.push_back(elapsed.count());
+        }
+
+        return times;
+
+    }
+
+    // Function to get a percentile
+    double percentile(std::vector<double> times, const double &p) {
+
+        // times: times per file
+        // p: percentile (between 0 and 1)
+
+        const size_t i = std::min(times.size() - 1u, static_cast<size_t>(p * times.size()));
+        std::nth_element(times.begin(), times.begin() + i, times.end());
+        return times[i];
+
+    }
+
+    // Function to print one row of results
+    void report(const size_t &nfiles, const std::string &cache, const std::vector<double> &times) {
+
+        // nfiles: size of the batch
+        // cache: state of the page cache
+        // times: times per file (microseconds)
+
+        // Total
+        double total = 0.0;
+        for (const double &t : times) total += t;
+
+        std::printf("%10zu %6s %12.2f %12.2f %12.2f %14.0f\n", nfiles, cache.c_str(),
+            percentile(times, 0.5), percentile(times, 0.99), total / times.size(), 1e6 * times.size() / total);
+
+    }
+}
+
+int main(int argc, char *argv[]) {
+
+    // Options
+    size_t max = 100000u;
+    std::string dir = "startup_files";
+
+    // Read them
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--max")) max = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--dir")) dir = argv[i + 1];
+        else { std::fprintf(stderr, "Unknown option %s\n", argv[i]); return 1; }
+    }
+
+    // Try to...
+    try {
+
+        // Write the files (each batch reads the first files)
+        std::filesystem::create_directories(dir);
+        std::vector<std::string> filenames;
+        for (size_t k = 0u; k < max; ++k) {
+            filenames.push_back(dir + "/parameters_" + std::to_string(k + 1u) + ".txt");
+            write(filenames.back(), k);
+        }
+
+        // Header
+        std::printf("%10s %6s %12s %12s %12s %14s\n", "files", "cache", "p50 (us)", "p99 (us)", "mean (us)", "files/s");
+
+        // Batch sizes (powers of ten, up to the largest one, always included)
+        std::vector<size_t> sizes;
+        for (size_t n = 1u; n < max; n *= 10u) sizes.push_back(n);
+        if (max) sizes.push_back(max);
+
+        // For each batch size...
+        for (const size_t &n : sizes) {
+
+            // Files of the batch
+            const std::vector<std::string> batch(filenames.begin(), filenames.begin() + n);
+
+            // Cold page cache
+            bool cold = true;
+            for (const std::string &filename : batch) cold = evict(filename) && cold;
+            if (cold) report(n, "cold", time(batch));
+            else std::printf("%10zu %6s %12s\n", n, "cold", "(skipped)");
+
+            // Warm page cache (read once beforehand)
+            time(batch);
+            report(n, "warm", time(batch));
+
+        }
+
+        // Clean up
+        std::filesystem::remove_all(dir);
+
+        // Keep the reads
+        if (sink == 0.12345) std::printf("\n");
+
+        // Exit
+        return 0;
+
+    }
+    catch (const std::exception& err) {
+
+        // Catch exceptions
+        std::fprintf(stderr, "Exception: %s\n", err.what());
+
+    }
+
+    // Return failure flag if got here
+    return 1;
+
+}
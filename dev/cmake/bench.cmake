@@ -0,0 +1,23 @@
+# CMakeLists.txt (Benchmarks)
+
+# CMake
+cmake_minimum_required(VERSION 3.16)
+
+# Project name
+project(readpars)
+
+# C++ standard
+set(CMAKE_CXX_STANDARD 20)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+
+# Boilerplate
+set(EXECUTABLE_OUTPUT_PATH ${CMAKE_BINARY_DIR})
+set(CMAKE_INSTALL_PREFIX ${CMAKE_SOURCE_DIR})
+
+# Release mode
+set(CMAKE_BUILD_TYPE "Release")
+
+# Source code
+add_subdirectory(tools)
+add_subdirectory(src)
+add_subdirectory(bench)
\ No newline at end of file
@@ -44,5 +44,6 @@ message(STATUS "CMAKE_C_FLAGS: ${CMAKE_C_FLAGS}")
 message(STATUS "CMAKE_EXE_LINKER_FLAGS: ${CMAKE_EXE_LINKER_FLAGS}")
 
 # Source code
+add_subdirectory(tools)
 add_subdirectory(src)
 add_subdirectory(tests)
@@ -23,4 +23,5 @@ set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -pg")
 set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} -pg")
 
 # Source code
+add_subdirectory(tools)
 add_subdirectory(src)
@@ -18,4 +18,5 @@ set(CMAKE_INSTALL_PREFIX ${CMAKE_SOURCE_DIR})
 set(CMAKE_BUILD_TYPE "Release")
 
 # Source code
+add_subdirectory(tools)
 add_subdirectory(src)
\ No newline at end of file
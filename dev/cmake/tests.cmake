@@ -33,5 +33,6 @@ set(CMAKE_INSTALL_PREFIX ${CMAKE_SOURCE_DIR})
 set(CMAKE_BUILD_TYPE "Debug")
 
 # Source code
+add_subdirectory(tools)
 add_subdirectory(src)
 add_subdirectory(tests)
\ No newline at end of file
@@ -0,0 +1,27 @@
+#!/bin/bash
+
+## Use this script to run the microbenchmarks and compare them with the
+## baseline in bench/baseline.json. The benchmarks must have been compiled
+## already (e.g. configuration bench.cmake). Pass --save to replace the
+## baseline with the new results instead (e.g. after a deliberate change,
+## or when moving to another machine).
+
+# Path to the benchmark
+BENCH="./bin/readpars_bench"
+
+# Path to the baseline
+BASELINE="./bench/baseline.json"
+
+# Check if the benchmark exists
+if [ ! -f "$BENCH" ]; then
+    echo "Error: Benchmark '$BENCH' does not exist. Please compile the benchmarks first."
+    exit 1
+fi
+
+# Save or compare
+if [ "$1" == "--save" ]; then
+    "$BENCH" --json "$BASELINE"
+    echo "Baseline saved to '$BASELINE'."
+else
+    "$BENCH" --baseline "$BASELINE"
+fi
@@ -3,11 +3,11 @@
 ## Run this script to switch from one CMake configuration to
 ## another. To be run from the root directory of the project.
 ## The name of the configuration to use must be provided as
-## e.g. --release, --tests, --profile or --coverage.
+## e.g. --release, --tests, --profile, --coverage or --bench.
 
 # Check if an argument is provided
 if [ $# -ne 1 ]; then
-    echo "Usage: $0 --release | --tests | --profile | --coverage"
+    echo "Usage: $0 --release | --tests | --profile | --coverage | --bench"
     exit 1
 fi
 
@@ -0,0 +1,334 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the broadcasting tools.
+
+#include "broadcast.hpp"
+
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <exception>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+#ifndef _WIN32
+
+namespace {
+
+    // Function to write a whole buffer into a pipe
+    void writeall(const int &fd, const char *data, size_t n) {
+
+        // fd: file descriptor to write into
+        // data: bytes to write
+        // n: number of bytes
+
+        // Until everything is written...
+        while (n > 0u) {
+
+            // Write as much as possible
+            const ssize_t k = ::write(fd, data, n);
+
+            // Retry if interrupted
+            if (k < 0 && errno == EINTR) continue;
+
+            // Error otherwise
+            if (k <= 0) throw std::runtime_error("Unable to send parameters to another process");
+
+            // Move on
+            data += k;
+            n -= static_cast<size_t>(k);
+
+        }
+    }
+
+    // Function to read a whole buffer from a pipe
+    void readall(const int &fd, char *data, size_t n) {
+
+        // fd: file descriptor to read from
+        // data: where to store the bytes
+        // n: number of bytes
+
+        // Until everything is read...
+        while (n > 0u) {
+
+            // Read as much as possible
+            const ssize_t k = ::read(fd, data, n);
+
+            // Retry if interrupted
+            if (k < 0 && errno == EINTR) continue;
+
+            // Error otherwise
+            if (k <= 0) throw std::runtime_error("Unable to receive parameters from another process");
+
+            // Move on
+            data += k;
+            n -= static_cast<size_t>(k);
+
+        }
+    }
+}
+
+// Constructor
+ForkTransport::ForkTransport(const int &n) :
+    rank(0),
+    size(n),
+    pipes(std::vector<int>()),
+    children(std::vector<int>())
+{
+
+    // n: total number of processes, including the calling one
+
+    // Check
+    assert(n > 0);
+
+    // For each process to create...
+    for (int i = 1; i < n; ++i) {
+
+        // Create a pipe from the root to the new process
+        int fds[2];
+        if (::pipe(fds) != 0)
+            throw std::runtime_error("Unable to create a pipe to another process");
+
+        // Create the new process
+        const pid_t pid = ::fork();
+
+        // Check
+        if (pid < 0)
+            throw std::runtime_error("Unable to create another process");
+
+        // If we are the new process...
+        if (pid == 0) {
+
+            // Keep only the reading end of our own pipe
+            for (int fd : pipes) ::close(fd);
+            ::close(fds[1]);
+            pipes.assign(1u, fds[0]);
+            children.clear();
+
+            // Set our rank
+            rank = i;
+
+            return;
+
+        }
+
+        // Otherwise keep the writing end
+        ::close(fds[0]);
+        pipes.push_back(fds[1]);
+        children.push_back(pid);
+
+    }
+}
+
+// Destructor
+ForkTransport::~ForkTransport() {
+
+    // Close the pipes
+    for (int fd : pipes) ::close(fd);
+
+    // Wait for the other processes if needed
+    if (rank == 0) join();
+
+    // Other processes never return into the code of the parent process
+    // (e.g. when an exception goes past their transport), and fail if
+    // they are leaving because of an exception
+    else ::_exit(std::uncaught_exceptions() > 0 ? 1 : 0);
+
+}
+
+// Function to send bytes from the root to all the other processes
+void ForkTransport::broadcast(std::vector<char> &buffer, const int &root) {
+
+    // buffer: bytes to send (on the root) or receive (elsewhere)
+    // root: rank of the sending process
+
+    // Note: The processes are only connected to the parent process, so it
+    // has to be the root.
+    if (root != 0)
+        throw std::runtime_error("Only the first process can broadcast in a local run");
+
+    // If we are the root...
+    if (rank == 0) {
+
+        // Size of the message
+        const uint64_t n = buffer.size();
+
+        // Send to everyone
+        for (int fd : pipes) {
+            writeall(fd, reinterpret_cast<const char*>(&n), sizeof(n));
+            writeall(fd, buffer.data(), buffer.size());
+        }
+
+        return;
+
+    }
+
+    // Otherwise receive the size of the message
+    uint64_t n;
+    readall(pipes[0u], reinterpret_cast<char*>(&n), sizeof(n));
+
+    // And the message itself
+    buffer.resize(n);
+    readall(pipes[0u], buffer.data(), n);
+
+}
+
+// Function to wait for the other processes
+int ForkTransport::join() {
+
+    // Check
+    assert(rank == 0);
+
+    // Number of processes that failed
+    int failed = 0;
+
+    // For each other process...
+    for (int pid : children) {
+
+        // Wait for it
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+
+        // Record failures
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) ++failed;
+
+    }
+
+    // Forget about them
+    children.clear();
+
+    return failed;
+
+}
+
+// Function to terminate a process other than the root
+void ForkTransport::leave(const bool &success) {
+
+    // success: whether the process succeeded
+
+    // Check
+    assert(rank != 0);
+
+    // Exit without running the cleanup of the parent process
+    ::_exit(success ? 0 : 1);
+
+}
+
+#endif
+
+#ifdef READPARS_USE_MPI
+
+// Constructor
+MpiTransport::MpiTransport(MPI_Comm comm) :
+    comm(comm)
+{
+
+    // comm: communicator to broadcast over
+
+}
+
+// Rank of the current process
+int MpiTransport::getrank() const {
+
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    return rank;
+
+}
+
+// Number of processes
+int MpiTransport::getsize() const {
+
+    int size;
+    MPI_Comm_size(comm, &size);
+    return size;
+
+}
+
+// Function to send bytes from the root to all the other processes
+void MpiTransport::broadcast(std::vector<char> &buffer, const int &root) {
+
+    // buffer: bytes to send (on the root) or receive (elsewhere)
+    // root: rank of the sending process
+
+    // Size of the message
+    uint64_t n = buffer.size();
+    MPI_Bcast(&n, 1, MPI_UINT64_T, root, comm);
+
+    // Prepare to receive
+    if (getrank() != root) buffer.resize(n);
+
+    // Send in chunks small enough for an int count
+    for (uint64_t i = 0u; i < n; i += INT_MAX) {
+        const int k = static_cast<int>(std::min<uint64_t>(n - i, INT_MAX));
+        MPI_Bcast(buffer.data() + i, k, MPI_BYTE, root, comm);
+    }
+}
+
+#endif
+
+// Function to parse a file on the root and share it with everyone
+ParSet bcastpars(const std::string &filename, Transport &transport, const int &root) {
+
+    // filename: name of the parameter file
+    // transport: channel between processes
+    // root: rank of the process reading the file
+
+    // Prepare to store the parameters
+    ParSet pars;
+
+    // Snapshot to share, and error message (empty if none)
+    std::vector<char> buffer;
+    std::vector<char> error;
+
+    // If we are the root...
+    if (transport.getrank() == root) {
+
+        // Parse the file, catching any error
+        std::string message;
+        try {
+            pars.load(filename);
+        } catch (const std::exception &e) {
+            message = e.what();
+            if (message.empty()) message = "Unable to read parameters";
+        }
+
+        // Serialize the result
+        error.assign(message.begin(), message.end());
+        if (error.empty()) buffer.assign(pars.data(), pars.data() + pars.bytes());
+
+    }
+
+    // Note: The error (if any) is shared before anything else, so that
+    // every process throws the same exception instead of some of them
+    // waiting forever for a snapshot that will never come.
+
+    // Share the error
+    transport.broadcast(error, root);
+
+    // Throw it everywhere if needed
+    if (!error.empty()) throw std::runtime_error(std::string(error.begin(), error.end()));
+
+    // Share the snapshot
+    transport.broadcast(buffer, root);
+
+    // The root keeps its own copy
+    if (transport.getrank() == root) return pars;
+
+    // Others take ownership of what they received, without copying
+    return ParSet(std::move(buffer));
+
+}
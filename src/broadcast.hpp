@@ -0,0 +1,116 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_BROADCAST_HPP
+#define READPARS_BROADCAST_HPP
+
+// This header contains tools to parse a parameter file once, on a single
+// process (the root), and share the result with all the other processes
+// of a distributed run, so that only one of them touches the file system.
+
+// Note: The way bytes travel between processes is abstracted away in the
+// Transport class. An MPI implementation is provided if the library is
+// compiled with READPARS_USE_MPI, and a local stand-in based on forked
+// processes can be used for testing on machines without MPI.
+
+// Note: If the file cannot be parsed on the root, every process throws
+// the same exception. Forked processes exit when their transport goes out
+// of scope, so they never run the code of their parent beyond it.
+
+#include "parset.hpp"
+
+#ifdef READPARS_USE_MPI
+#include <mpi.h>
+#endif
+
+// Abstract channel between processes
+class Transport {
+
+public:
+
+    // Destructor
+    virtual ~Transport() = default;
+
+    // Getters
+    virtual int getrank() const = 0;
+    virtual int getsize() const = 0;
+
+    // Function to send bytes from the root to all the other processes
+    virtual void broadcast(std::vector<char>&, const int&) = 0;
+
+};
+
+#ifndef _WIN32
+
+// Local stand-in forking processes connected by pipes
+class ForkTransport : public Transport {
+
+public:
+
+    // Constructor
+    ForkTransport(const int&);
+
+    // Destructor
+    ~ForkTransport();
+
+    // Getters
+    int getrank() const override { return rank; }
+    int getsize() const override { return size; }
+
+    // Communication
+    void broadcast(std::vector<char>&, const int&) override;
+
+    // Termination
+    int join();
+    [[noreturn]] void leave(const bool&);
+
+private:
+
+    // Members
+    int rank;
+    int size;
+    std::vector<int> pipes;
+    std::vector<int> children;
+
+};
+
+#endif
+
+#ifdef READPARS_USE_MPI
+
+// Transport over an MPI communicator
+class MpiTransport : public Transport {
+
+public:
+
+    // Constructor
+    MpiTransport(MPI_Comm = MPI_COMM_WORLD);
+
+    // Getters
+    int getrank() const override;
+    int getsize() const override;
+
+    // Communication
+    void broadcast(std::vector<char>&, const int&) override;
+
+private:
+
+    // Members
+    MPI_Comm comm;
+
+};
+
+#endif
+
+// Function to parse a file on the root and share it with everyone
+ParSet bcastpars(const std::string&, Transport&, const int& = 0);
+
+#endif
@@ -0,0 +1,314 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_CONSTPARS_HPP
+#define READPARS_CONSTPARS_HPP
+
+// This header contains the ConstPars class, a reader with the same rules
+// as ReadPars but working on text already in the program (e.g. a string
+// literal with default parameters), which can run at compile time.
+
+// Note: Everything here is constexpr, so a parameter struct filled from
+// embedded text can itself be constexpr, e.g.:
+//
+//   constexpr Defaults defaults = readdefaults("popsize 100\nmutrate 0.01");
+//
+// in which case the defaults cost nothing at startup, and any error in
+// them (invalid value, failed check, unknown name...) stops compilation
+// instead of throwing when the program runs. The same code can also run
+// at run time, where errors are thrown as usual.
+
+// Note: Numbers are converted exactly when they have at most 15 or so
+// significant digits and a small exponent (e.g. 0.01, 100, 2.5e-6), as
+// the result is then a single correctly rounded operation between two
+// exactly representable numbers. Other numbers are handed over to the
+// usual conversion at run time, and rejected at compile time.
+
+#include "readpars.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+class ConstPars {
+
+public:
+
+    // Constructor
+    constexpr ConstPars(const std::string_view &text, const std::string_view &filename = "embedded text") :
+        text(text),
+        filename(filename),
+        pos(0u),
+        count(0u),
+        empty(false),
+        comment(false),
+        line(),
+        cursor(0u),
+        name()
+    {
+
+        // text: content to read, laid out like a parameter file
+        // filename: name used in error messages
+
+        // Check if the text is empty
+        if (text.empty()) throw std::runtime_error("File " + std::string(filename) + " is empty");
+
+    }
+
+    // Getters
+    constexpr bool iseof() const { return pos >= text.size(); }
+    constexpr bool iseol() const { return skip(line, cursor) == line.size(); }
+    constexpr bool isempty() const { return empty; }
+    constexpr bool iscomment() const { return comment; }
+    constexpr size_t getcount() const { return count; }
+    constexpr std::string_view getname() const { return name; }
+
+    // Function to read the next line
+    constexpr void readline() {
+
+        // Check
+        assert(!iseof());
+
+        // Find the end of the line
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) end = text.size();
+
+        // Take it (without the carriage return of text with Windows line
+        // endings, as in ReadPars::readline)
+        line = text.substr(pos, end - pos);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1u);
+        pos = end + 1u;
+        cursor = 0u;
+        name = std::string_view();
+
+        // Count it
+        ++count;
+
+        // Check if the line is empty or a comment
+        empty = line.empty();
+        comment = !empty && line[0u] == '#';
+
+        // If needed...
+        if (empty || comment) return;
+
+        // Read the name of the parameter
+        if (!next(name)) throw std::runtime_error("Could not read parameter name" + where());
+
+        // Check that we are not at the end of the line
+        if (iseol()) throw std::runtime_error("No value for parameter " + std::string(name) + where());
+
+    }
+
+    // Function to error on invalid parameter (never constexpr, as it
+    // always throws, so calling it at compile time is a compile error)
+    void readerror() const {
+
+        throw std::runtime_error("Invalid parameter: " + std::string(name) + where());
+
+    }
+
+    // Function to read a single value
+    template <typename T, typename F = std::nullptr_t>
+    constexpr void readvalue(T &value, const F &check = nullptr) {
+
+        // value: variable to read into
+        // check: function used to check the value (returning an empty
+        // string if the value is fine, or a message otherwise)
+
+        // Read value in
+        read(value, check);
+
+        // Check that we have reached the end of the line
+        if (!iseol()) throw std::runtime_error("Too many values for parameter " + std::string(name) + where());
+
+    }
+
+    // Function to read a fixed number of values
+    template <typename T, size_t N, typename F = std::nullptr_t>
+    constexpr void readvalues(std::array<T, N> &values, const F &check = nullptr) {
+
+        // values: array to read into
+        // check: function used to check individual values
+
+        // For each value...
+        for (size_t i = 0u; i < N; ++i) {
+
+            // If too few values...
+            if (iseol()) throw std::runtime_error("Too few values for parameter " + std::string(name) + where());
+
+            // Read it
+            read(values[i], check);
+
+        }
+
+        // If too many values...
+        if (!iseol()) throw std::runtime_error("Too many values for parameter " + std::string(name) + where());
+
+    }
+
+    // Function to parse a piece of text into a number (exactly, see above)
+    static constexpr bool parse(const std::string_view &input, double &x) {
+
+        // input: text to parse
+        // x: number to parse into
+
+        // Position
+        size_t i = 0u;
+
+        // Sign
+        const bool negative = i < input.size() && input[i] == '-';
+        if (negative) ++i;
+
+        // Significant digits and exponent
+        uint64_t mantissa = 0u;
+        int64_t exponent = 0;
+        size_t ndigits = 0u;
+        bool exact = true;
+        bool dot = false;
+        bool any = false;
+
+        // For each character of the mantissa...
+        for (; i < input.size(); ++i) {
+
+            // Decimal point (only one)
+            if (input[i] == '.') {
+                if (dot) return false;
+                dot = true;
+                continue;
+            }
+
+            // Otherwise a digit
+            if (input[i] < '0' || input[i] > '9') break;
+            any = true;
+
+            // Leading zeros do not count
+            if (mantissa == 0u && input[i] == '0') { if (dot) --exponent; continue; }
+
+            // Keep up to nineteen digits (the rest makes the number inexact)
+            if (ndigits < 19u) {
+                mantissa = 10u * mantissa + static_cast<uint64_t>(input[i] - '0');
+                ++ndigits;
+                if (dot) --exponent;
+            } else {
+                if (input[i] != '0') exact = false;
+                if (!dot) ++exponent;
+            }
+        }
+
+        // There must be at least one digit
+        if (!any) return false;
+
+        // Exponent, if any
+        if (i < input.size() && (input[i] == 'e' || input[i] == 'E')) {
+
+            // Sign
+            ++i;
+            const bool minus = i < input.size() && input[i] == '-';
+            if (minus) ++i;
+
+            // Digits
+            if (i == input.size()) return false;
+            int64_t e = 0;
+            for (; i < input.size() && input[i] >= '0' && input[i] <= '9'; ++i)
+                if (e < 100000) e = 10 * e + (input[i] - '0');
+
+            // Add it
+            exponent += minus ? -e : e;
+
+        }
+
+        // Nothing must be left
+        if (i != input.size()) return false;
+
+        // Zero
+        if (mantissa == 0u) { x = negative ? -0.0 : 0.0; return true; }
+
+        // Exact powers of ten
+        constexpr double powers[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        // Fast path: both numbers exact, so one rounding only
+        if (exact && mantissa <= (uint64_t(1u) << 53u) && exponent >= -22 && exponent <= 22) {
+
+            const double m = static_cast<double>(mantissa);
+            x = exponent < 0 ? m / powers[-exponent] : m * powers[exponent];
+            if (negative) x = -x;
+            return true;
+
+        }
+
+        // Otherwise use the usual conversion (not available at compile time)
+        if (std::is_constant_evaluated()) return false;
+        return ReadPars::parse(input, x);
+
+    }
+
+private:
+
+    // Members
+    std::string_view text;
+    std::string_view filename;
+    size_t pos;
+    size_t count;
+    bool empty;
+    bool comment;
+    std::string_view line;
+    size_t cursor;
+    std::string_view name;
+
+    // Function to skip spaces
+    static constexpr size_t skip(const std::string_view &s, size_t i) {
+        while (i < s.size() && ReadPars::isspace(s[i])) ++i;
+        return i;
+    }
+
+    // Location for error messages (only reached when throwing)
+    std::string where() const { return " in line " + std::to_string(count) + " of file " + std::string(filename); }
+
+    // Function to read the next word on the line
+    constexpr bool next(std::string_view &word) {
+
+        // word: where to store the word
+
+        // Split it off (same rules as ReadPars)
+        word = ReadPars::nextword(line, cursor);
+
+        // Check
+        return !word.empty() && ReadPars::isvalid(word);
+
+    }
+
+    // Function to read a value from the current line
+    template <typename T, typename F>
+    constexpr void read(T &value, const F &check) {
+
+        // value: variable to read into
+        // check: function used to check the value
+
+        // Make sure the next value can be read
+        std::string_view word;
+        if (!next(word)) throw std::runtime_error("Could not read value for parameter " + std::string(name) + where());
+
+        // Convert it
+        double x = 0.0;
+        if (!parse(word, x) || !ReadPars::coerce(x, value)) throw std::runtime_error("Invalid value type for parameter " + std::string(name) + where());
+
+        // Check validity
+        if constexpr (!std::is_same_v<F, std::nullptr_t>) {
+            const std::string error(check(value));
+            if (!error.empty()) throw std::runtime_error("Parameter " + std::string(name) + " " + error + where());
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,308 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the fingerprinting tools.
+
+// Note: The mixing functions are those of MurmurHash3 (x64, 128-bit
+// variant, by Austin Appleby, public domain), fed with 64-bit words
+// rather than raw bytes so that the result does not depend on the byte
+// order of the machine.
+
+#include "fingerprint.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+    // Mixing constants
+    const uint64_t c1 = 0x87c37b91114253d5ull;
+    const uint64_t c2 = 0x4cf5ad432745937full;
+
+    // Function to rotate the bits of a word
+    uint64_t rotl(const uint64_t &x, const int &r) { return (x << r) | (x >> (64 - r)); }
+
+    // Final mixing of a word
+    uint64_t fmix(uint64_t k) {
+
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ull;
+        k ^= k >> 33;
+
+        return k;
+
+    }
+
+    // Function to get the bits of a number in canonical form
+    uint64_t canonical(const double &x) {
+
+        // Note: Adding zero turns -0 into +0, so both zeros hash the same.
+        const double y = x + 0.0;
+
+        // Bits
+        uint64_t k;
+        std::memcpy(&k, &y, sizeof(k));
+
+        return k;
+
+    }
+
+    // Function to get many numbers in canonical form
+    template <typename T>
+    void canonicals(const T *x, const size_t &n, uint64_t *out) {
+
+        // x: numbers to convert
+        // n: number of numbers
+        // out: where to store the bits
+
+        for (size_t i = 0u; i < n; ++i) out[i] = canonical(static_cast<double>(x[i]));
+
+    }
+
+    // Function to tell if an integer is exact as a double
+    template <typename T>
+    bool isexact(const T &x) {
+
+        // x: integer to check
+
+        // Note: The upper bound (2^63 or 2^64) is exact as a double, and
+        // rules out values that round up to it, which cannot be converted
+        // back into the integer type.
+
+        const double y = static_cast<double>(x);
+        const double upper = 2.0 * static_cast<double>(std::numeric_limits<T>::max() / 2 + 1);
+        return y < upper && static_cast<T>(y) == x;
+
+    }
+
+    // Function to add the integers that are not exact as doubles
+    template <typename T>
+    void inexacts(Hasher &hasher, const T *x, const size_t &n, const size_t &offset) {
+
+        // hasher: hash to add to
+        // x: integers to check
+        // n: number of integers
+        // offset: position of the first integer in the parameter
+
+        for (size_t i = 0u; i < n; ++i) {
+            if (isexact(x[i])) [[likely]] continue;
+            hasher.update(static_cast<uint64_t>(offset + i));
+            hasher.update(static_cast<uint64_t>(x[i]));
+        }
+    }
+}
+
+// Hexadecimal representation of a fingerprint
+std::string Fingerprint::str() const {
+
+    // Digits
+    const char *digits = "0123456789abcdef";
+
+    // Prepare
+    std::string s(32u, '0');
+
+    // Write each half, most significant digits first
+    for (int i = 0; i < 16; ++i) {
+        s[15 - i] = digits[(high >> (4 * i)) & 0xfu];
+        s[31 - i] = digits[(low >> (4 * i)) & 0xfu];
+    }
+
+    return s;
+
+}
+
+// Constructor
+Hasher::Hasher(const uint64_t &seed) :
+    h1(seed),
+    h2(seed),
+    pending(0u),
+    odd(false),
+    count(0u)
+{
+
+    // seed: starting value of the hash
+
+}
+
+// Function to mix in two words
+void Hasher::mix(const uint64_t &a, const uint64_t &b) {
+
+    // a, b: words to mix in
+
+    // First half
+    uint64_t k1 = a;
+    k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; h1 ^= k1;
+    h1 = rotl(h1, 27); h1 += h2; h1 = h1 * 5u + 0x52dce729u;
+
+    // Second half
+    uint64_t k2 = b;
+    k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; h2 ^= k2;
+    h2 = rotl(h2, 31); h2 += h1; h2 = h2 * 5u + 0x38495ab5u;
+
+}
+
+// Function to add a word
+void Hasher::update(const uint64_t &x) {
+
+    // x: word to add
+
+    // Count it
+    ++count;
+
+    // Mix in pairs
+    if (odd) mix(pending, x);
+    else pending = x;
+
+    // Update the parity
+    odd = !odd;
+
+}
+
+// Function to add many words
+void Hasher::update(const uint64_t *x, const size_t &n) {
+
+    // x: words to add
+    // n: number of words
+
+    // Index of the next word
+    size_t i = 0u;
+
+    // Complete the pending pair if needed
+    if (odd && n > 0u) update(x[i++]);
+
+    // Mix the rest pair by pair
+    for (; i + 1u < n; i += 2u) {
+        mix(x[i], x[i + 1u]);
+        count += 2u;
+    }
+
+    // Keep the last one if needed
+    if (i < n) update(x[i]);
+
+}
+
+// Function to add a piece of text
+void Hasher::update(const std::string_view &text) {
+
+    // text: text to add
+
+    // Length first, so that consecutive texts cannot be confused
+    update(static_cast<uint64_t>(text.size()));
+
+    // Then the characters, packed eight per word
+    for (size_t i = 0u; i < text.size(); i += 8u) {
+
+        uint64_t k = 0u;
+        for (size_t j = 0u; j < 8u && i + j < text.size(); ++j)
+            k |= static_cast<uint64_t>(static_cast<unsigned char>(text[i + j])) << (8u * j);
+
+        update(k);
+
+    }
+}
+
+// Function to finalize the hash
+Fingerprint Hasher::digest() const {
+
+    // Copy the state
+    uint64_t a = h1;
+    uint64_t b = h2;
+
+    // Add the word left alone
+    if (odd) {
+        uint64_t k1 = pending;
+        k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; a ^= k1;
+    }
+
+    // Add the length
+    a ^= count;
+    b ^= count;
+
+    // Final mixing
+    a += b; b += a;
+    a = fmix(a); b = fmix(b);
+    a += b; b += a;
+
+    return { a, b };
+
+}
+
+// Function to compute the fingerprint of a parameter set
+Fingerprint fingerprint(const ParSet &pars) {
+
+    // pars: parameter set
+
+    // Prepare
+    Hasher hasher;
+
+    // Buffer of canonical values
+    const size_t nbuffer = 64u;
+    uint64_t buffer[nbuffer];
+
+    // Number of parameters counted
+    uint64_t n = 0u;
+
+    // For each parameter in alphabetical order...
+    for (size_t k = 0u; k < pars.size(); ++k) {
+
+        // Index of the parameter
+        const size_t i = pars.getsorted(k);
+
+        // Skip if it appears again later (the last occurrence wins)
+        if (k + 1u < pars.size() && pars.getname(pars.getsorted(k + 1u)) == pars.getname(i)) continue;
+
+        // Name and number of values
+        hasher.update(std::string_view(pars.getname(i)));
+        hasher.update(static_cast<uint64_t>(pars.getcount(i)));
+
+        // Stored values
+        const ParSet::Type type = pars.gettype(i);
+        const char *block = pars.getblock(i);
+
+        // For each chunk of values...
+        for (size_t j = 0u; j < pars.getcount(i); j += nbuffer) {
+
+            // Size of the chunk
+            const size_t m = std::min(nbuffer, pars.getcount(i) - j);
+
+            // Convert into canonical form, as doubles whatever the stored type
+            // (one tight loop per type, so the compiler can vectorize them)
+            switch (type) {
+                case ParSet::Integer: canonicals(reinterpret_cast<const int64_t*>(block) + j, m, buffer); break;
+                case ParSet::Unsigned: canonicals(reinterpret_cast<const uint64_t*>(block) + j, m, buffer); break;
+                case ParSet::Boolean: canonicals(reinterpret_cast<const bool*>(block) + j, m, buffer); break;
+                default: canonicals(reinterpret_cast<const double*>(block) + j, m, buffer);
+            }
+
+            // Add them
+            hasher.update(buffer, m);
+
+            // Integers too large to be exact as doubles (e.g. seeds) are
+            // also added with their exact bits, so that they cannot be
+            // confused with their neighbors
+            if (type == ParSet::Integer) inexacts(hasher, reinterpret_cast<const int64_t*>(block) + j, m, j);
+            if (type == ParSet::Unsigned) inexacts(hasher, reinterpret_cast<const uint64_t*>(block) + j, m, j);
+
+        }
+
+        // Count
+        ++n;
+
+    }
+
+    // Number of parameters last
+    hasher.update(n);
+
+    return hasher.digest();
+
+}
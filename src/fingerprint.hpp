@@ -0,0 +1,75 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_FINGERPRINT_HPP
+#define READPARS_FINGERPRINT_HPP
+
+// This header contains tools to compute a 128-bit fingerprint of the
+// content of a parameter set, e.g. to recognize runs that were already
+// done with the same parameters.
+
+// Note: The fingerprint only depends on the effective parameters (names
+// and numeric values), not on comments, blank lines, spacing, the order
+// of the lines or the way numbers were written (e.g. 1, 1.0 and 1e0 are
+// the same). Integers too large to be exact as doubles are told apart by
+// their exact value. If a parameter appears more than once, only the last
+// occurrence counts, as when the file is read line by line.
+
+#include "parset.hpp"
+
+// 128-bit fingerprint
+struct Fingerprint {
+
+    uint64_t high;
+    uint64_t low;
+
+    // Comparison
+    bool operator==(const Fingerprint&) const = default;
+
+    // Hexadecimal representation
+    std::string str() const;
+
+};
+
+// Streaming 128-bit hash of 64-bit words
+class Hasher {
+
+public:
+
+    // Constructor
+    Hasher(const uint64_t& = 0u);
+
+    // Setters
+    void update(const uint64_t&);
+    void update(const uint64_t*, const size_t&);
+    void update(const std::string_view&);
+
+    // Getters
+    Fingerprint digest() const;
+
+private:
+
+    // State
+    uint64_t h1;
+    uint64_t h2;
+    uint64_t pending;
+    bool odd;
+    uint64_t count;
+
+    // Function to mix in two words
+    void mix(const uint64_t&, const uint64_t&);
+
+};
+
+// Function to compute the fingerprint of a parameter set
+Fingerprint fingerprint(const ParSet&);
+
+#endif
@@ -0,0 +1,368 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParCache class.
+
+#include "parcache.hpp"
+
+#include <filesystem>
+
+// Default memory budget of the global cache (in bytes)
+static const size_t GLOBAL_CAPACITY = 256u << 20u;
+
+// Constructor
+ParCache::ParCache(const size_t &capacity) :
+    mutex(),
+    items(std::list<Item>()),
+    index(std::unordered_map<std::string, std::list<Item>::iterator>()),
+    pending(std::unordered_map<std::string, Pending>()),
+    waiting(std::unordered_map<std::thread::id, std::string>()),
+    capacity(capacity),
+    bytes(0u),
+    hits(0u),
+    misses(0u)
+{
+
+    // capacity: memory budget in bytes
+
+}
+
+// Cache shared by the whole process
+ParCache& ParCache::global() {
+
+    // Created on first use
+    static ParCache cache(GLOBAL_CAPACITY);
+
+    return cache;
+
+}
+
+// Stamps of the files included by the sets being parsed by the current
+// thread, innermost last (so each set knows what it depends on)
+thread_local std::vector<std::vector<ParCache::Stamp>*> ParCache::including;
+
+// Function to tell the state of a file on disk
+bool ParCache::stamp(const std::string &filename, Stamp &s) {
+
+    // filename: name of the file
+    // s: stamp to fill in
+
+    // Note: Returns false if the file cannot be identified.
+
+    namespace fs = std::filesystem;
+
+    // Path
+    std::error_code error;
+    const fs::path path = fs::weakly_canonical(filename, error);
+    if (error) return false;
+
+    // Last modification time
+    const fs::file_time_type mtime = fs::last_write_time(filename, error);
+    if (error) return false;
+
+    // Size
+    const uintmax_t size = fs::file_size(filename, error);
+    if (error) return false;
+
+    // Fill in
+    s = { path.string(), mtime.time_since_epoch().count(), size };
+
+    return true;
+
+}
+
+// Function to tell if a cached set is up to date
+bool ParCache::isfresh(const Item &item) {
+
+    // item: cached set
+
+    // Every file it comes from must be unchanged
+    for (const Stamp &s : item.stamps) {
+        Stamp now;
+        if (!stamp(s.path, now) || now.mtime != s.mtime || now.size != s.size) return false;
+    }
+
+    return true;
+
+}
+
+// Function to tell if a file being parsed waits, through the files it
+// includes, on a thread
+bool ParCache::iswaitedby(const std::string &path, const std::thread::id &thread) const {
+
+    // path: file being parsed
+    // thread: thread that would wait on it
+
+    // Note: This must be called with the lock held. Files including each
+    // other and parsed by different threads would otherwise wait on each
+    // other forever, instead of being reported as circular inclusions.
+
+    // Follow who waits on whom (at most once per waiting thread)
+    std::string key = path;
+    for (size_t k = 0u; k <= waiting.size(); ++k) {
+
+        // Thread parsing the file
+        const auto it = pending.find(key);
+        if (it == pending.end()) return false;
+        if (it->second.owner == thread) return true;
+
+        // File that thread waits on, if any
+        const auto jt = waiting.find(it->second.owner);
+        if (jt == waiting.end()) return false;
+        key = jt->second;
+
+    }
+
+    return false;
+
+}
+
+// Function to parse a file and record the files it includes
+ParCache::Item ParCache::parse(const std::string &filename, const Stamp &self) {
+
+    // filename: name of the file to read
+    // self: stamp of the file
+
+    // Parse it, and record the files it includes along the way
+    Item item{ std::vector<Stamp>(1u, self), ParSet() };
+    including.push_back(&item.stamps);
+    struct Done { ~Done() { including.pop_back(); } } done;
+    item.pars.load(filename);
+
+    return item;
+
+}
+
+// Function to load a parameter file through the cache
+ParSet ParCache::load(const std::string &filename) {
+
+    // filename: name of the file to read
+
+    // Identify the file
+    Stamp self;
+
+    // If the file cannot be identified, parse it the usual way (which
+    // will give the usual error message if it cannot be read)
+    if (!stamp(filename, self)) {
+        ParSet pars;
+        pars.load(filename);
+        return pars;
+    }
+
+    // Set including this one (if any), which depends on what this one does
+    std::vector<Stamp> *parent = including.empty() ? nullptr : including.back();
+
+    // Function to pass on what a set depends on
+    auto passon = [&](const Item &item) {
+        if (parent) parent->insert(parent->end(), item.stamps.begin(), item.stamps.end());
+    };
+
+    // Copy of the cached version, if any
+    Item cached;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(self.path);
+        if (it != index.end()) { cached = *it->second; found = true; }
+    }
+
+    // If nothing it comes from has changed (checked without the lock)...
+    if (found && isfresh(cached)) {
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Count
+        ++hits;
+
+        // Mark as most recently used (if still there)
+        auto it = index.find(self.path);
+        if (it != index.end() && it->second->pars.data() == cached.pars.data())
+            items.splice(items.begin(), items, it->second);
+
+        passon(cached);
+
+        return cached.pars;
+
+    }
+
+    // Otherwise, wait if another thread is parsing it already, or tell
+    // the others that we are
+    std::promise<Item> promise;
+    std::shared_future<Item> result;
+    const std::thread::id me = std::this_thread::get_id();
+    bool owner = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Another thread may have stored a new version in the meantime
+        auto jt = index.find(self.path);
+        if (jt != index.end() && (!found || jt->second->pars.data() != cached.pars.data())) {
+            ++hits;
+            items.splice(items.begin(), items, jt->second);
+            passon(*jt->second);
+            return jt->second->pars;
+        }
+
+        auto it = pending.find(self.path);
+        if (it == pending.end()) {
+            owner = true;
+            pending[self.path] = { promise.get_future().share(), me };
+        } else if (!iswaitedby(self.path, me)) {
+            result = it->second.result;
+            waiting[me] = self.path;
+        }
+    }
+
+    // Wait for the other thread
+    if (!owner && result.valid()) {
+
+        // Stop waiting when done, even with an error
+        struct Done {
+            ParCache &cache;
+            std::thread::id me;
+            ~Done() { std::lock_guard<std::mutex> lock(cache.mutex); cache.waiting.erase(me); }
+        } done{ *this, me };
+
+        // Its result (its error is thrown here too, as a copy, since the
+        // same exception object should not be shared between threads)
+        Item item;
+        try { item = result.get(); }
+        catch (const std::exception &error) { throw std::runtime_error(error.what()); }
+
+        // Count
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++hits;
+        }
+
+        passon(item);
+
+        return item.pars;
+
+    }
+
+    // Note: A thread that would wait on itself (through files including
+    // each other) parses the file on its own, which reports the circular
+    // inclusion.
+
+    // Not the one parsing it for the others
+    if (!owner) {
+        const Item item = parse(filename, self);
+        passon(item);
+        return item.pars;
+    }
+
+    // Parse it (without holding the lock, so that other threads are not
+    // blocked in the meantime)
+    Item item;
+    try {
+        item = parse(filename, self);
+    } catch (const std::exception &error) {
+
+        // Share (a copy of) the error with the waiting threads
+        std::lock_guard<std::mutex> lock(mutex);
+        promise.set_exception(std::make_exception_ptr(std::runtime_error(error.what())));
+        pending.erase(self.path);
+        throw;
+
+    } catch (...) {
+
+        // Same with other errors
+        std::lock_guard<std::mutex> lock(mutex);
+        promise.set_exception(std::current_exception());
+        pending.erase(self.path);
+        throw;
+
+    }
+
+    // Store it
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Count
+        ++misses;
+
+        // Replace any older version
+        auto it = index.find(self.path);
+        if (it != index.end()) {
+            bytes -= it->second->pars.bytes();
+            items.erase(it->second);
+            index.erase(it);
+        }
+
+        // Add as most recently used
+        items.push_front(item);
+        index[self.path] = items.begin();
+        bytes += item.pars.bytes();
+
+        // Stay within budget
+        evict();
+
+        // Share it with the waiting threads
+        promise.set_value(item);
+        pending.erase(self.path);
+
+    }
+
+    passon(item);
+
+    return item.pars;
+
+}
+
+// Function to drop the least recently used sets until within budget
+void ParCache::evict() {
+
+    // Note: This must be called with the lock held.
+
+    // While over budget...
+    while (bytes > capacity && !items.empty()) {
+
+        // Least recently used
+        const Item &item = items.back();
+
+        // Forget it (copies still in use elsewhere remain valid)
+        bytes -= item.pars.bytes();
+        index.erase(item.stamps.front().path);
+        items.pop_back();
+
+    }
+}
+
+// Function to change the memory budget
+void ParCache::setcapacity(const size_t &value) {
+
+    // value: new budget in bytes
+
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = value;
+    evict();
+
+}
+
+// Function to empty the cache
+void ParCache::clear() {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    items.clear();
+    index.clear();
+    bytes = 0u;
+    hits = 0u;
+    misses = 0u;
+
+}
+
+// Getters
+size_t ParCache::size() const { std::lock_guard<std::mutex> lock(mutex); return items.size(); }
+size_t ParCache::getbytes() const { std::lock_guard<std::mutex> lock(mutex); return bytes; }
+size_t ParCache::getcapacity() const { std::lock_guard<std::mutex> lock(mutex); return capacity; }
+size_t ParCache::gethits() const { std::lock_guard<std::mutex> lock(mutex); return hits; }
+size_t ParCache::getmisses() const { std::lock_guard<std::mutex> lock(mutex); return misses; }
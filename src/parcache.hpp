@@ -0,0 +1,115 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARCACHE_HPP
+#define READPARS_PARCACHE_HPP
+
+// This header contains the ParCache class, a cache of parsed parameter
+// files for programs that load the same files over and over again (e.g.
+// drivers of parameter sweeps).
+
+// Note: Files are identified by their path, last modification time and
+// size, so a file that changes on disk is parsed again. The same holds for
+// the files it includes, directly or not. The cache keeps
+// the most recently used sets within a memory budget, and can be shared
+// between threads. Since parameter sets are immutable and copying one
+// only copies a pointer, a cache hit costs next to nothing.
+
+// Note: Files are checked on disk and parsed without holding the lock of
+// the cache. A file requested by several threads at once (e.g. a base
+// included by all the documents parsed by ParDocs::parseall) is parsed by
+// the first of them, while the others wait for its result, so each file is
+// parsed once per process.
+
+#include "parset.hpp"
+
+#include <list>
+#include <mutex>
+#include <future>
+#include <thread>
+#include <unordered_map>
+
+class ParCache {
+
+public:
+
+    // Constructor
+    ParCache(const size_t&);
+
+    // Setters
+    ParSet load(const std::string&);
+    void setcapacity(const size_t&);
+    void clear();
+
+    // Getters
+    size_t size() const;
+    size_t getbytes() const;
+    size_t getcapacity() const;
+    size_t gethits() const;
+    size_t getmisses() const;
+
+    // Cache shared by the whole process
+    static ParCache& global();
+
+private:
+
+    // State of a file on disk
+    struct Stamp {
+
+        std::string path;
+        int64_t mtime;
+        uintmax_t size;
+
+    };
+
+    // Cached file (stamped first, then the files it includes)
+    struct Item {
+
+        std::vector<Stamp> stamps;
+        ParSet pars;
+
+    };
+
+    // File being parsed by a thread, for the others to wait on
+    struct Pending {
+
+        std::shared_future<Item> result;
+        std::thread::id owner;
+
+    };
+
+    // Members
+    mutable std::mutex mutex;
+    std::list<Item> items;
+    std::unordered_map<std::string, std::list<Item>::iterator> index;
+    std::unordered_map<std::string, Pending> pending;
+    std::unordered_map<std::thread::id, std::string> waiting;
+    size_t capacity;
+    size_t bytes;
+    size_t hits;
+    size_t misses;
+
+    // Stamps of the files included by the sets being parsed by the
+    // current thread, innermost last
+    static thread_local std::vector<std::vector<Stamp>*> including;
+
+    // Private setters
+    void evict();
+    Item parse(const std::string&, const Stamp&);
+
+    // Private getters
+    static bool stamp(const std::string&, Stamp&);
+    static bool isfresh(const Item&);
+    bool iswaitedby(const std::string&, const std::thread::id&) const;
+
+};
+
+#endif
@@ -0,0 +1,228 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParCorpus class.
+
+#include "parcorpus.hpp"
+
+#include <charconv>
+#include <cstdio>
+#include <stdexcept>
+
+namespace {
+
+    // Stems of parameter names
+    const char *stems[] = {
+        "popsize", "mutrate", "growth", "tend", "tsave", "ntraits", "sigma",
+        "selection", "dispersal", "pop.size", "env.temp.mean", "env.temp.sd",
+        "migration", "nloci", "recomb", "carrying", "seed", "verbose"
+    };
+
+    // Size of the pieces written at once
+    const size_t chunk = 1u << 20u;
+
+}
+
+// Constructor
+ParCorpus::ParCorpus(const Shape &shape) :
+    shape(shape),
+    state(shape.seed),
+    nlines(0u),
+    errors(std::vector<size_t>())
+{
+
+    // shape: shape of the files to generate
+
+}
+
+// Function to draw the next random number
+uint64_t ParCorpus::next() {
+
+    // Note: This is SplitMix64, small and fast, and the same everywhere.
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27u)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31u);
+
+}
+
+// Function to draw a number between zero and one
+double ParCorpus::uniform() {
+
+    // Top 53 bits, so every double in [0, 1) is equally likely
+    return static_cast<double>(next() >> 11u) * 0x1.0p-53;
+
+}
+
+// Function to write a random value
+void ParCorpus::value(std::string &out) {
+
+    // out: text to write into
+
+    // Prepare
+    char buffer[64];
+    std::to_chars_result result;
+
+    // Pick a format
+    const double u = uniform();
+    const double x = uniform();
+    const bool negative = uniform() < 0.1;
+
+    // Integer
+    if (u < shape.integers) {
+        result = std::to_chars(buffer, buffer + sizeof buffer, next() % 1000000u);
+    }
+
+    // Scientific notation
+    else if (u < shape.integers + shape.exponents) {
+        const double y = (negative ? -1.0 : 1.0) * (1.0 + 9.0 * x) * (next() % 2u ? 1e-5 : 1e5);
+        result = std::to_chars(buffer, buffer + sizeof buffer, y, std::chars_format::scientific, 4);
+    }
+
+    // Long mantissa
+    else if (u < shape.integers + shape.exponents + shape.mantissas) {
+        result = std::to_chars(buffer, buffer + sizeof buffer, (negative ? -100.0 : 100.0) * x, std::chars_format::fixed, 17);
+    }
+
+    // Plain decimal
+    else {
+        result = std::to_chars(buffer, buffer + sizeof buffer, (negative ? -100.0 : 100.0) * x, std::chars_format::fixed, 4);
+    }
+
+    // Add it (without plus signs, which are not allowed in parameter files)
+    for (const char *c = buffer; c != result.ptr; ++c) if (*c != '+') out += *c;
+
+}
+
+// Function to write the corpus piece by piece
+template <typename F>
+void ParCorpus::run(const F &flush) {
+
+    // flush: function taking each piece of text
+
+    // Start again from the seed
+    state = shape.seed;
+    nlines = 0u;
+    errors.clear();
+
+    // Text to flush
+    std::string out;
+    out.reserve(chunk + 256u);
+
+    // For each parameter...
+    for (size_t i = 0u; i < shape.nparams; ++i) {
+
+        // Comment line
+        if (uniform() < shape.comments) {
+            out += "# Parameter ";
+            out += std::to_string(i + 1u);
+            out += '\n';
+            ++nlines;
+        }
+
+        // Blank line
+        if (uniform() < shape.blanks) {
+            out += '\n';
+            ++nlines;
+        }
+
+        // Name
+        out += stems[next() % (sizeof stems / sizeof stems[0])];
+        out += std::to_string(i + 1u);
+        ++nlines;
+
+        // Number of values
+        size_t n = 1u;
+        if (uniform() < shape.vectors && shape.maxlength > 1u) n = 2u + next() % (shape.maxlength - 1u);
+
+        // Error, if any (and which)
+        const bool error = uniform() < shape.errors;
+        const uint64_t kind = next() % 3u;
+        const size_t where = next() % n;
+
+        // Missing value
+        if (error && kind == 0u) {
+            errors.push_back(nlines);
+            out += '\n';
+            continue;
+        }
+
+        // Values
+        for (size_t j = 0u; j < n; ++j) {
+
+            // Separator
+            out += ' ';
+
+            // Invalid number or invalid character
+            if (error && j == where) {
+                errors.push_back(nlines);
+                out += kind == 1u ? "1.2.3" : "4;5";
+                continue;
+            }
+
+            // Valid value
+            value(out);
+
+            // Flush if needed
+            if (out.size() >= chunk) { flush(out); out.clear(); }
+
+        }
+
+        // End of the line
+        out += '\n';
+
+        // Flush if needed
+        if (out.size() >= chunk) { flush(out); out.clear(); }
+
+    }
+
+    // Last piece
+    flush(out);
+
+}
+
+// Function to generate the whole corpus as text
+std::string ParCorpus::generate() {
+
+    // Prepare
+    std::string text;
+
+    // Gather the pieces
+    run([&](const std::string &piece) { text += piece; });
+
+    return text;
+
+}
+
+// Function to write the corpus into a file
+void ParCorpus::write(const std::string &filename) {
+
+    // filename: name of the file
+
+    // Open the file
+    std::FILE *file = std::fopen(filename.c_str(), "wb");
+
+    // Check
+    if (!file) throw std::runtime_error("Unable to open file " + filename);
+
+    // Write the pieces
+    bool ok = true;
+    run([&](const std::string &piece) {
+        ok = ok && std::fwrite(piece.data(), 1u, piece.size(), file) == piece.size();
+    });
+
+    // Close the file
+    ok = std::fclose(file) == 0 && ok;
+
+    // Check
+    if (!ok) throw std::runtime_error("Unable to write file " + filename);
+
+}
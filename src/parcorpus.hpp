@@ -0,0 +1,92 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARCORPUS_HPP
+#define READPARS_PARCORPUS_HPP
+
+// This header contains the ParCorpus class, which generates synthetic
+// parameter files of a given shape, for benchmarks and stress tests (see
+// also the readpars-corpus tool in tools/).
+
+// Note: The files are entirely determined by their shape and seed. Random
+// numbers come from a generator written here (not from the standard library,
+// whose distributions differ between implementations), so the same shape
+// gives the same file, byte for byte, on any platform.
+
+// Note: Each parameter takes one line, with a name looking like those of a
+// real model (e.g. mutrate12, pop.size3), and one value or a vector. Values
+// can be integers, plain decimals, numbers in scientific notation or numbers
+// with long mantissas. Comment and blank lines are scattered in between. A
+// proportion of the parameters can be given an error (a missing value, an
+// invalid number or an invalid character), whose lines are recorded so the
+// errors reported by a reader can be checked.
+
+// Note: Files are written in pieces, so vectors can be very long (up to 10^8
+// values) without the whole file being held in memory.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ParCorpus {
+
+public:
+
+    // Shape of the files
+    struct Shape {
+
+        size_t nparams = 100u;          // number of parameters
+        double vectors = 0.2;           // proportion of vectors
+        size_t maxlength = 10u;         // maximum length of vectors
+        double comments = 0.1;          // comment lines per parameter
+        double blanks = 0.05;           // blank lines per parameter
+        double integers = 0.3;          // proportion of integer values
+        double exponents = 0.2;         // proportion in scientific notation
+        double mantissas = 0.1;         // proportion with long mantissas
+        double errors = 0.0;            // proportion of parameters with an error
+        uint64_t seed = 1u;             // seed of the generator
+
+    };
+
+    // Constructor
+    ParCorpus(const Shape&);
+
+    // Writers
+    std::string generate();
+    void write(const std::string&);
+
+    // Getters
+    const Shape& getshape() const { return shape; }
+    size_t getnlines() const { return nlines; }
+    const std::vector<size_t>& geterrors() const { return errors; }
+
+private:
+
+    // Members
+    Shape shape;
+    uint64_t state;
+    size_t nlines;
+    std::vector<size_t> errors;
+
+    // Random numbers
+    uint64_t next();
+    double uniform();
+
+    // Function to write the corpus piece by piece
+    template <typename F>
+    void run(const F&);
+
+    // Function to write a random value
+    void value(std::string&);
+
+};
+
+#endif
@@ -0,0 +1,191 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParDocs class.
+
+#include "pardocs.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <fstream>
+
+// Note: Threads are std::jthread, which join when destroyed, so that an
+// exception thrown while launching them does not end the program.
+
+// Line separating two documents
+static const std::string_view SEPARATOR = "---";
+
+// Constructor
+ParDocs::ParDocs() :
+    filename(""),
+    content(""),
+    documents(std::vector<Document>())
+{}
+
+// Function to read a file and find its documents
+void ParDocs::load(const std::string &filename) {
+
+    // filename: name of the file to read
+
+    // Remember the file
+    this->filename = filename;
+
+    // Open the file
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) throw std::runtime_error("Unable to open file " + filename);
+
+    // Read it in one go
+    content.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(content.data(), content.size());
+
+    // Check if the file is empty
+    if (content.empty()) throw std::runtime_error("File " + filename + " is empty");
+
+    // Start afresh
+    documents.clear();
+
+    // First document
+    Document document = { 0u, 0u, 0u };
+
+    // Number of lines so far
+    size_t nlines = 0u;
+
+    // For each line...
+    for (size_t start = 0u; start < content.size(); ++nlines) {
+
+        // End of the line
+        const char *newline = static_cast<const char*>(std::memchr(content.data() + start, '\n', content.size() - start));
+        const size_t end = newline ? newline - content.data() : content.size();
+
+        // Text of the line (without the carriage return of files with
+        // Windows line endings)
+        std::string_view line(content.data() + start, end - start);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1u);
+
+        // If it separates two documents...
+        if (line == SEPARATOR) {
+
+            // Close the current document
+            document.end = start;
+            documents.push_back(document);
+
+            // Open the next one
+            document = { end + 1u, 0u, nlines + 1u };
+
+        }
+
+        // Move on
+        start = end + 1u;
+
+    }
+
+    // Close the last document
+    document.end = std::max(document.begin, content.size());
+    documents.push_back(document);
+
+}
+
+// Function to parse a single document
+ParSet ParDocs::parse(const size_t &i) const {
+
+    // i: index of the document
+
+    // Check
+    assert(i < documents.size());
+
+    // Location of the document
+    const Document &document = documents[i];
+
+    // Prepare to store the parameters
+    ParBuilder builder(filename);
+
+    // Note: A document without any text gives an empty set.
+    if (document.end == document.begin) return builder.build();
+
+    // Prepare to read the document
+    ReadPars reader(filename);
+
+    // Open it
+    reader.open(std::string_view(content.data() + document.begin, document.end - document.begin), document.offset);
+
+    // For each line in the document...
+    while (!reader.iseof()) {
+
+        // Read a line
+        reader.readline();
+
+        // Skip empty and comment lines
+        if (reader.isempty() || reader.iscomment()) continue;
+
+        // Record the parameter
+        builder.readline(reader);
+
+    }
+
+    // Close it
+    reader.close();
+
+    return builder.build();
+
+}
+
+// Function to parse all the documents
+std::vector<ParSet> ParDocs::parseall(const size_t &nthreads) const {
+
+    // nthreads: number of threads to use (zero to use all the cores)
+
+    // Prepare to store the sets
+    std::vector<ParSet> sets(documents.size());
+
+    // Errors encountered by each document
+    std::vector<std::exception_ptr> errors(documents.size());
+
+    // Next document to parse
+    std::atomic<size_t> next(0u);
+
+    // Work done by each thread
+    auto work = [&]() {
+
+        // Take documents one by one until none is left
+        for (size_t i = next++; i < documents.size(); i = next++) {
+
+            // Parse it, keeping any error for later
+            try {
+                sets[i] = parse(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    // Number of threads
+    size_t n = nthreads ? nthreads : std::thread::hardware_concurrency();
+    n = std::max(size_t(1u), std::min(n, documents.size()));
+
+    // Launch them (the current thread is one of them)
+    std::vector<std::jthread> threads;
+    for (size_t t = 1u; t < n; ++t) threads.emplace_back(work);
+    work();
+
+    // Wait for them
+    for (std::jthread &thread : threads) thread.join();
+
+    // Report the first error in file order
+    for (const std::exception_ptr &error : errors)
+        if (error) std::rethrow_exception(error);
+
+    return sets;
+
+}
@@ -0,0 +1,61 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARDOCS_HPP
+#define READPARS_PARDOCS_HPP
+
+// This header contains the ParDocs class, a file holding many complete
+// parameter sets (documents), separated by lines reading exactly "---".
+
+// Note: The file is read into memory in one go and the boundaries of the
+// documents are found in a single pass, without parsing anything. Each
+// document can then be parsed on its own, or all of them at once on
+// several threads. This replaces directories of many tiny files, where
+// opening each file costs more than parsing it. Error messages give the
+// line numbers within the whole file.
+
+#include "parset.hpp"
+
+class ParDocs {
+
+public:
+
+    // Constructor
+    ParDocs();
+
+    // Setters
+    void load(const std::string&);
+
+    // Getters
+    size_t size() const { return documents.size(); }
+    size_t getline(const size_t &i) const { return documents[i].offset + 1u; }
+    ParSet parse(const size_t&) const;
+    std::vector<ParSet> parseall(const size_t& = 0u) const;
+
+private:
+
+    // Location of a document in the file
+    struct Document {
+
+        size_t begin;
+        size_t end;
+        size_t offset;
+
+    };
+
+    // Members
+    std::string filename;
+    std::string content;
+    std::vector<Document> documents;
+
+};
+
+#endif
@@ -0,0 +1,351 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the code generator.
+
+#include "pargen.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+    // Parameter described in the schema
+    struct Field {
+
+        std::string name;
+        std::string member;
+        std::string type;
+        size_t count;
+        std::string check;
+        std::vector<std::string> defaults;
+
+    };
+
+    // Types that can be used, with their C++ counterparts
+    const std::vector<std::pair<std::string, std::string>> types = {
+        { "double", "double" },
+        { "int", "int" },
+        { "long", "long" },
+        { "unsigned", "unsigned" },
+        { "size", "size_t" },
+        { "bool", "bool" }
+    };
+
+    // Checks that can be used, with their conditions and messages
+    struct Check { std::string name; std::string condition; std::string message; };
+    const std::vector<Check> checks = {
+        { "none", "", "" },
+        { "positive", "x >= 0", "must be positive" },
+        { "strictpos", "x > 0", "must be strictly positive" },
+        { "proportion", "x >= 0 && x <= 1", "must be between 0 and 1" }
+    };
+
+    // Function to hash a name with a given seed
+    uint64_t hash(const std::string &name, const uint64_t &seed) {
+
+        // name: name to hash
+        // seed: seed of the hash
+
+        // Note: This is FNV-1a with a seeded start, and must match the
+        // function written into the generated code.
+        uint64_t h = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+        for (char c : name) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001b3ull;
+        }
+
+        return h;
+
+    }
+
+    // Function to find a hash that sends each name to its own slot
+    void perfect(const std::vector<Field> &fields, uint64_t &seed, size_t &nslots) {
+
+        // fields: parameters of the schema
+        // seed: seed of the hash (output)
+        // nslots: number of slots (output)
+
+        // From as few slots as names, try a few seeds before adding a slot
+        for (nslots = std::max(fields.size(), size_t(1u));; ++nslots) {
+            for (seed = 0u; seed < 1000u; ++seed) {
+
+                // Slots taken so far
+                std::vector<bool> taken(nslots, false);
+
+                // Place each name
+                bool ok = true;
+                for (size_t i = 0u; ok && i < fields.size(); ++i) {
+                    const size_t slot = hash(fields[i].name, seed) % nslots;
+                    ok = !taken[slot];
+                    taken[slot] = true;
+                }
+
+                // Done if no two names collide
+                if (ok) return;
+
+            }
+        }
+    }
+
+    // Function to write a whole number as a literal of a given type
+    template <typename T>
+    std::string whole(const std::string &text, const double &x, const std::string &error) {
+
+        // text: value as written in the schema
+        // x: value parsed as a number
+        // error: message if the value does not fit
+
+        // Note: The value must fit the type of the member itself (e.g. int,
+        // not just long long), or the generated code would narrow it.
+
+        // Exactly if written in full, or coerced otherwise
+        T value;
+        if (!ReadPars::parseint(text, value) && !ReadPars::coerce(x, value)) throw std::runtime_error(error);
+
+        // Unsigned ones with their suffix
+        if constexpr (std::is_unsigned_v<T>) return std::to_string(value) + "u";
+
+        // The smallest signed one cannot be written as minus a literal
+        else if (value == std::numeric_limits<T>::min()) return "(" + std::to_string(value + 1) + " - 1)";
+        else return std::to_string(value);
+
+    }
+
+    // Function to write a value as a literal of a given type
+    std::string literal(const std::string &text, const std::string &type, const std::string &error) {
+
+        // text: value as written in the schema
+        // type: type of the parameter (as in the schema)
+        // error: message if the value does not fit
+
+        // Parse it
+        double x;
+        if (!ReadPars::parse(text, x)) throw std::runtime_error(error);
+
+        // Coerce it into the type of the member
+        bool b;
+        if (type == "double") return text;
+        if (type == "bool") { if (!ReadPars::coerce(x, b)) throw std::runtime_error(error); return b ? "true" : "false"; }
+        if (type == "int") return whole<int>(text, x, error);
+        if (type == "long") return whole<long>(text, x, error);
+        if (type == "unsigned") return whole<unsigned>(text, x, error);
+        return whole<size_t>(text, x, error);
+
+    }
+}
+
+// Function to generate a parser from a schema file
+std::string genparser(const std::string &filename, const std::string &name) {
+
+    // filename: name of the schema file
+    // name: name of the struct to generate
+
+    // Prepare to read the schema
+    ReadPars reader(filename);
+    std::vector<Field> fields;
+
+    // Open the file
+    reader.open();
+
+    // For each line...
+    while (!reader.iseof()) {
+
+        // Read a line
+        reader.readline();
+
+        // Skip empty and comment lines
+        if (reader.isempty() || reader.iscomment()) continue;
+
+        // Location for error messages
+        const std::string location = " for parameter " + reader.getname() + " in line " + std::to_string(reader.getcount()) + " of file " + filename;
+
+        // Read the description
+        std::vector<std::string> words;
+        reader.readall(words);
+
+        // Check
+        if (words.size() < 3u) throw std::runtime_error("Incomplete description" + location);
+
+        // Prepare the parameter
+        Field field = { reader.getname(), reader.getname(), words[0u], 0u, words[2u], {} };
+
+        // Member name (dots and minus signs are not allowed in C++ names)
+        std::replace(field.member.begin(), field.member.end(), '.', '_');
+        std::replace(field.member.begin(), field.member.end(), '-', '_');
+        if (!std::isalpha(static_cast<unsigned char>(field.member[0u]))) field.member = "p_" + field.member;
+
+        // Check the type
+        if (std::find_if(types.begin(), types.end(), [&](const auto &t) { return t.first == field.type; }) == types.end())
+            throw std::runtime_error("Invalid type" + location);
+
+        // Check the number of values
+        double n;
+        if (!ReadPars::parse(words[1u], n) || !ReadPars::coerce(n, field.count) || field.count == 0u)
+            throw std::runtime_error("Invalid number of values" + location);
+
+        // Check the check
+        if (std::find_if(checks.begin(), checks.end(), [&](const Check &c) { return c.name == field.check; }) == checks.end())
+            throw std::runtime_error("Invalid check" + location);
+
+        // Default values, if any
+        for (size_t j = 3u; j < words.size(); ++j)
+            field.defaults.push_back(literal(words[j], field.type, "Invalid default value" + location));
+
+        // Check their number
+        if (!field.defaults.empty() && field.defaults.size() != field.count)
+            throw std::runtime_error("Wrong number of default values" + location);
+
+        // Check that names are unique
+        for (const Field &other : fields)
+            if (other.name == field.name || other.member == field.member)
+                throw std::runtime_error("Duplicate name" + location);
+
+        // Add it
+        fields.push_back(field);
+
+    }
+
+    // Close the file
+    reader.close();
+
+    // Find a perfect hash for the names
+    uint64_t seed;
+    size_t nslots;
+    perfect(fields, seed, nslots);
+
+    // Guard of the header
+    std::string guard = "READPARS_GEN_" + name + "_HPP";
+    std::transform(guard.begin(), guard.end(), guard.begin(), [](char c) { return std::toupper(static_cast<unsigned char>(c)); });
+
+    // Prepare to write
+    std::ostringstream out;
+
+    // Preamble
+    out << "// Generated by readpars-gen from " << filename << ". Do not edit.\n\n";
+    out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+    out << "#include \"readpars.hpp\"\n\n#include <cstdint>\n#include <string_view>\n\n";
+    out << "struct " << name << " {\n\n";
+
+    // Members
+    out << "    // Parameters\n";
+    for (const Field &field : fields) {
+
+        // C++ type
+        std::string type = std::find_if(types.begin(), types.end(), [&](const auto &t) { return t.first == field.type; })->second;
+        if (field.count > 1u) type = "std::vector<" + type + ">";
+
+        // Declaration
+        out << "    " << type << " " << field.member;
+
+        // Initial value
+        if (field.defaults.empty() && field.count > 1u) out << " = " << type << "(" << field.count << "u)";
+        else if (field.defaults.empty()) out << " = " << type << "()";
+        else if (field.count == 1u) out << " = " << field.defaults[0u];
+        else {
+            out << " = { ";
+            for (size_t j = 0u; j < field.count; ++j) out << (j ? ", " : "") << field.defaults[j];
+            out << " }";
+        }
+
+        out << ";\n";
+
+    }
+
+    // Hash
+    out << "\n    // Function to send each expected name to its own slot\n";
+    out << "    static constexpr size_t slot(const std::string_view &name) {\n";
+    out << "        uint64_t h = 0xcbf29ce484222325ull ^ (" << seed << "ull * 0x9e3779b97f4a7c15ull);\n";
+    out << "        for (char c : name) { h ^= static_cast<unsigned char>(c); h *= 0x100000001b3ull; }\n";
+    out << "        return h % " << nslots << "u;\n";
+    out << "    }\n\n";
+
+    // Parser
+    out << "    // Function to read a parameter file\n";
+    out << "    void read(const std::string &filename) {\n\n";
+    out << "        // Prepare to read\n";
+    out << "        ReadPars reader(filename);\n";
+    out << "        bool seen[" << std::max(fields.size(), size_t(1u)) << "] = {};\n\n";
+    out << "        // Open the file\n";
+    out << "        reader.open();\n\n";
+    out << "        // For each line in the file...\n";
+    out << "        while (!reader.iseof()) {\n\n";
+    out << "            // Read a line\n";
+    out << "            reader.readline();\n\n";
+    out << "            // Skip empty and comment lines\n";
+    out << "            if (reader.isempty() || reader.iscomment()) continue;\n\n";
+    out << "            // Name and location of the parameter\n";
+    out << "            const std::string name = reader.getname();\n";
+    out << "            const std::string where = \" in line \" + std::to_string(reader.getcount()) + \" of file \" + filename;\n\n";
+    out << "            // Dispatch on the name\n";
+    out << "            switch (slot(name)) {\n";
+
+    // One case per parameter
+    for (size_t i = 0u; i < fields.size(); ++i) {
+
+        // Parameter
+        const Field &field = fields[i];
+        const Check &check = *std::find_if(checks.begin(), checks.end(), [&](const Check &c) { return c.name == field.check; });
+        const std::string type = std::find_if(types.begin(), types.end(), [&](const auto &t) { return t.first == field.type; })->second;
+
+        // Unsigned values are always positive, so that check can go
+        const bool checked = !check.condition.empty() && !(check.name == "positive" && (field.type == "unsigned" || field.type == "size"));
+
+        // Its case
+        out << "\n                case " << hash(field.name, seed) % nslots << "u: {\n";
+        out << "                    if (name != \"" << field.name << "\") reader.readerror();\n";
+        out << "                    if (seen[" << i << "]) throw std::runtime_error(\"Duplicate parameter " << field.name << "\" + where);\n";
+        out << "                    seen[" << i << "] = true;\n";
+
+        // Read and check the values
+        if (field.count == 1u) {
+
+            out << "                    reader.readvalue<" << type << ">(" << field.member << ");\n";
+            if (checked) {
+                out << "                    const " << type << " &x = " << field.member << ";\n";
+                out << "                    if (!(" << check.condition << ")) throw std::runtime_error(\"Parameter " << field.name << " " << check.message << "\" + where);\n";
+            }
+
+        } else {
+
+            out << "                    reader.readvalues<" << type << ">(" << field.member << ", " << field.count << "u);\n";
+            if (checked) {
+                out << "                    for (size_t j = 0u; j < " << field.count << "u; ++j) {\n";
+                out << "                        const " << type << " x = " << field.member << "[j];\n";
+                out << "                        if (!(" << check.condition << ")) throw std::runtime_error(\"Parameter " << field.name << " " << check.message << "\" + where);\n";
+                out << "                    }\n";
+            }
+        }
+
+        out << "                    break;\n";
+        out << "                }\n";
+
+    }
+
+    // Unknown names
+    out << "\n                default: reader.readerror();\n\n";
+    out << "            }\n        }\n\n";
+    out << "        // Close the file\n";
+    out << "        reader.close();\n\n";
+
+    // Missing parameters
+    out << "        // Check that required parameters were given\n";
+    for (size_t i = 0u; i < fields.size(); ++i)
+        if (fields[i].defaults.empty())
+            out << "        if (!seen[" << i << "]) throw std::runtime_error(\"Missing parameter " << fields[i].name << " in file \" + filename);\n";
+
+    out << "\n    }\n};\n\n#endif\n";
+
+    return out.str();
+
+}
@@ -0,0 +1,42 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARGEN_HPP
+#define READPARS_PARGEN_HPP
+
+// This header contains the code generator used by the readpars-gen tool
+// (see tools/), which turns a schema file into a C++ header with a struct
+// holding the parameters and a parser written specifically for them.
+
+// Note: Each line of the schema describes one parameter, as:
+//
+//   name type count check [default values]
+//
+// where type is one of double, int, long, unsigned, size or bool, count is
+// the number of values, and check is one of none, positive, strictpos or
+// proportion. Parameters without default values are required. E.g.:
+//
+//   popsize size 1 strictpos 100
+//   mutrate double 1 proportion 0.01
+//   genes double 4 none
+//
+// The generated parser reads the file with ReadPars, but finds what to do
+// with each name through a switch on a hash that is perfect for the names
+// of the schema (found when generating), reads the exact number of values
+// expected, and checks them in place, without any lookup or function
+// object at run time. It also reports missing and duplicate parameters.
+
+#include "readpars.hpp"
+
+// Function to generate a parser from a schema file
+std::string genparser(const std::string&, const std::string& = "Parameters");
+
+#endif
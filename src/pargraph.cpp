@@ -0,0 +1,512 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParGraph class.
+
+#include "pargraph.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+// Largest number of values an expression can produce
+static const size_t MAX_VALUES = 1u << 24u;
+
+namespace {
+
+    // Thrown when an expression cannot be compiled or evaluated
+    struct Invalid {};
+
+    // Names of the functions, with their number of arguments
+    struct Builtin { const char *name; ParGraph::Function function; size_t nargs; };
+    const Builtin builtins[] = {
+        { "rep", ParGraph::Rep, 2u },
+        { "sum", ParGraph::Sum, 1u },
+        { "min", ParGraph::Min, 1u },
+        { "max", ParGraph::Max, 1u },
+        { "exp", ParGraph::Exp, 1u },
+        { "log", ParGraph::Log, 1u },
+        { "sqrt", ParGraph::Sqrt, 1u },
+        { "abs", ParGraph::Abs, 1u }
+    };
+
+    // Recursive descent compiler from text to stack machine code
+    class Compiler {
+
+    public:
+
+        // Constructor
+        Compiler(const std::string_view &text, std::vector<ParGraph::Op> &code, std::vector<double> &numbers, std::vector<std::string> &refs) :
+            text(text), pos(0u), code(code), numbers(numbers), refs(refs)
+        {
+
+            // text: expression to compile
+            // code: where to write the instructions
+            // numbers: where to store the numbers
+            // refs: where to store the names of referenced parameters
+
+        }
+
+        // Function to compile the whole expression
+        void compile() {
+
+            // Read an expression
+            expression();
+
+            // Make sure nothing is left
+            skip();
+            if (pos != text.size()) throw Invalid();
+
+        }
+
+    private:
+
+        // Members
+        std::string_view text;
+        size_t pos;
+        std::vector<ParGraph::Op> &code;
+        std::vector<double> &numbers;
+        std::vector<std::string> &refs;
+
+        // Function to skip spaces
+        void skip() { while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) ++pos; }
+
+        // Function to consume a character if it is the next one
+        bool accept(const char &c) {
+
+            skip();
+            if (pos < text.size() && text[pos] == c) { ++pos; return true; }
+            return false;
+
+        }
+
+        // Function to add an instruction
+        void emit(const ParGraph::Op::Code &op, const size_t &arg = 0u, const size_t &nargs = 0u) { code.push_back({ op, arg, nargs }); }
+
+        // expression: term (('+' | '-') term)*
+        void expression() {
+
+            term();
+            for (;;) {
+                if (accept('+')) { term(); emit(ParGraph::Op::Add); }
+                else if (accept('-')) { term(); emit(ParGraph::Op::Sub); }
+                else break;
+            }
+        }
+
+        // term: unary (('*' | '/') unary)*
+        void term() {
+
+            unary();
+            for (;;) {
+                if (accept('*')) { unary(); emit(ParGraph::Op::Mul); }
+                else if (accept('/')) { unary(); emit(ParGraph::Op::Div); }
+                else break;
+            }
+        }
+
+        // unary: '-' unary | power
+        void unary() {
+
+            if (accept('-')) { unary(); emit(ParGraph::Op::Neg); }
+            else power();
+
+        }
+
+        // power: primary ('^' unary)?
+        void power() {
+
+            primary();
+            if (accept('^')) { unary(); emit(ParGraph::Op::Pow); }
+
+        }
+
+        // primary: number | name | name '(' arguments ')' | '(' expression ')'
+        void primary() {
+
+            skip();
+
+            // Check
+            if (pos == text.size()) throw Invalid();
+
+            // Parenthesized expression
+            if (accept('(')) {
+                expression();
+                if (!accept(')')) throw Invalid();
+                return;
+            }
+
+            // Start of the token
+            const size_t start = pos;
+            const char c = text[pos];
+
+            // Number
+            if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+
+                // Digits and dots, with an optional exponent
+                while (pos < text.size() && (std::isdigit(static_cast<unsigned char>(text[pos])) || text[pos] == '.')) ++pos;
+                if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E')) {
+                    ++pos;
+                    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) ++pos;
+                    while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) ++pos;
+                }
+
+                // Parse it
+                double x;
+                if (!ReadPars::parse(text.substr(start, pos - start), x)) throw Invalid();
+
+                // Store it
+                emit(ParGraph::Op::Number, numbers.size());
+                numbers.push_back(x);
+                return;
+
+            }
+
+            // Otherwise a name
+            if (!std::isalpha(static_cast<unsigned char>(c))) throw Invalid();
+            while (pos < text.size() && (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '.' || text[pos] == '_')) ++pos;
+            const std::string name(text.substr(start, pos - start));
+
+            // Function call
+            if (accept('(')) {
+
+                // Find the function
+                const Builtin *builtin = nullptr;
+                for (const Builtin &b : builtins) if (name == b.name) builtin = &b;
+                if (!builtin) throw Invalid();
+
+                // Read the arguments
+                size_t nargs = 0u;
+                if (!accept(')')) {
+                    do { expression(); ++nargs; } while (accept(','));
+                    if (!accept(')')) throw Invalid();
+                }
+
+                // Check
+                if (nargs != builtin->nargs) throw Invalid();
+
+                // Call
+                emit(ParGraph::Op::Call, builtin->function, nargs);
+                return;
+
+            }
+
+            // Reference to another parameter
+            const auto it = std::find(refs.begin(), refs.end(), name);
+            emit(ParGraph::Op::Param, static_cast<size_t>(it - refs.begin()));
+            if (it == refs.end()) refs.push_back(name);
+
+        }
+    };
+
+    // Function to combine two vectors value by value
+    template <typename F>
+    std::vector<double> combine(const std::vector<double> &a, const std::vector<double> &b, F f) {
+
+        // a, b: vectors to combine
+        // f: operation to apply
+
+        // A single value goes with every value of the other side
+        if (a.size() != b.size() && a.size() != 1u && b.size() != 1u) throw Invalid();
+
+        // Prepare
+        const size_t n = std::max(a.size(), b.size());
+        std::vector<double> c(n);
+
+        // Combine
+        for (size_t i = 0u; i < n; ++i) c[i] = f(a[a.size() == 1u ? 0u : i], b[b.size() == 1u ? 0u : i]);
+
+        return c;
+
+    }
+
+    // Function to apply an operation to every value
+    template <typename F>
+    std::vector<double> apply(std::vector<double> a, F f) {
+
+        // a: values
+        // f: operation to apply
+
+        for (double &x : a) x = f(x);
+        return a;
+
+    }
+}
+
+// Error messages
+std::string ParGraph::errorExpression(const Node &node) const { return "Invalid expression for parameter " + node.name + " in line " + std::to_string(node.line) + " of file " + filename; }
+std::string ParGraph::errorUnknown(const Node &node, const std::string &name) const { return "Unknown parameter " + name + " in expression for parameter " + node.name + " in line " + std::to_string(node.line) + " of file " + filename; }
+std::string ParGraph::errorCircular(const Node &node) const { return "Circular definition of parameter " + node.name + " in line " + std::to_string(node.line) + " of file " + filename; }
+
+// Constructor
+ParGraph::ParGraph() :
+    filename(""),
+    nodes(std::vector<Node>()),
+    order(std::vector<size_t>())
+{}
+
+// Function to read and compile a parameter file
+void ParGraph::load(const std::string &filename) {
+
+    // filename: name of the file to read
+
+    // Remember the file
+    this->filename = filename;
+
+    // Start afresh
+    nodes.clear();
+    order.clear();
+
+    // Prepare to read
+    ReadPars reader(filename);
+
+    // Open the file
+    reader.open();
+
+    // For each line in the file...
+    while (!reader.iseof()) {
+
+        // Read a line
+        reader.readline();
+
+        // Skip empty and comment lines
+        if (reader.isempty() || reader.iscomment()) continue;
+
+        // Prepare a new parameter
+        Node node = { reader.getname(), reader.getcount(), {}, {}, {}, {} };
+
+        // What comes after the name
+        const std::string text = reader.getrest();
+
+        // Try to read it as plain numbers first
+        size_t cursor = 0u;
+        bool plain = true;
+        for (std::string_view word = ReadPars::nextword(text, cursor); plain && !word.empty(); word = ReadPars::nextword(text, cursor)) {
+            double x;
+            plain = ReadPars::isvalid(word) && ReadPars::parse(word, x);
+            if (plain) node.numbers.push_back(x);
+        }
+
+        // Otherwise compile the expression
+        if (!plain) {
+
+            // Start again
+            node.numbers.clear();
+
+            // Compile
+            try {
+                Compiler(text, node.code, node.numbers, node.refs).compile();
+            } catch (const Invalid&) {
+                throw std::runtime_error(errorExpression(node));
+            }
+        }
+
+        // Add it
+        nodes.push_back(node);
+
+    }
+
+    // Close the file
+    reader.close();
+
+    // Resolve the references and sort the graph
+    link();
+    sort();
+
+}
+
+// Function to resolve the references between parameters
+void ParGraph::link() {
+
+    // Last definition of each parameter
+    std::unordered_map<std::string, size_t> index;
+    for (size_t i = 0u; i < nodes.size(); ++i) index[nodes[i].name] = i;
+
+    // For each parameter...
+    for (Node &node : nodes) {
+
+        // Resolve each name it refers to
+        node.deps.clear();
+        for (const std::string &name : node.refs) {
+
+            const auto it = index.find(name);
+            if (it == index.end()) throw std::runtime_error(errorUnknown(node, name));
+            node.deps.push_back(it->second);
+
+        }
+    }
+}
+
+// Function to sort the parameters so each comes after those it depends on
+void ParGraph::sort() {
+
+    // State of each parameter (0: not visited, 1: in progress, 2: done)
+    std::vector<int> state(nodes.size(), 0);
+
+    // Stack of (parameter, next dependency to visit)
+    std::vector<std::pair<size_t, size_t>> stack;
+
+    // Prepare
+    order.clear();
+    order.reserve(nodes.size());
+
+    // For each parameter in file order...
+    for (size_t root = 0u; root < nodes.size(); ++root) {
+
+        // Skip if already sorted
+        if (state[root]) continue;
+
+        // Depth-first search
+        stack.push_back({ root, 0u });
+        state[root] = 1;
+
+        while (!stack.empty()) {
+
+            // Current parameter
+            auto &[i, k] = stack.back();
+
+            // If all its dependencies are done, it can be placed
+            if (k == nodes[i].deps.size()) {
+                state[i] = 2;
+                order.push_back(i);
+                stack.pop_back();
+                continue;
+            }
+
+            // Otherwise visit the next dependency
+            const size_t j = nodes[i].deps[k++];
+
+            // A dependency in progress closes a cycle
+            if (state[j] == 1) throw std::runtime_error(errorCircular(nodes[j]));
+
+            // Visit it if needed
+            if (state[j] == 0) {
+                state[j] = 1;
+                stack.push_back({ j, 0u });
+            }
+        }
+    }
+}
+
+// Function to evaluate a single parameter
+std::vector<double> ParGraph::run(const Node &node, const std::vector<std::vector<double>> &values) const {
+
+    // node: parameter to evaluate
+    // values: values of the parameters evaluated so far
+
+    // Plain numbers
+    if (node.code.empty()) return node.numbers;
+
+    // Stack of intermediate results
+    std::vector<std::vector<double>> stack;
+
+    // For each instruction...
+    for (const Op &op : node.code) {
+
+        // Values to push
+        if (op.code == Op::Number) { stack.push_back({ node.numbers[op.arg] }); continue; }
+        if (op.code == Op::Param) { stack.push_back(values[node.deps[op.arg]]); continue; }
+
+        // Negation
+        if (op.code == Op::Neg) { stack.back() = apply(stack.back(), [](double x) { return -x; }); continue; }
+
+        // Function calls
+        if (op.code == Op::Call) {
+
+            // Arguments
+            std::vector<double> &x = stack[stack.size() - op.nargs];
+
+            switch (op.arg) {
+
+                case Rep: {
+
+                    // Number of repeats (a whole number, bounded so the
+                    // result stays within the largest number of values)
+                    const std::vector<double> &n = stack.back();
+                    size_t k;
+                    if (n.size() != 1u || !ReadPars::coerce(n[0u], k) || k > MAX_VALUES) throw Invalid();
+                    if (!x.empty() && k > MAX_VALUES / x.size()) throw Invalid();
+
+                    // Repeat
+                    std::vector<double> y;
+                    y.reserve(x.size() * k);
+                    for (size_t r = 0u; r < k; ++r) y.insert(y.end(), x.begin(), x.end());
+                    x = y;
+                    break;
+
+                }
+
+                case Sum: { double s = 0.0; for (double v : x) s += v; x = { s }; break; }
+                case Min: if (x.empty()) throw Invalid(); x = { *std::min_element(x.begin(), x.end()) }; break;
+                case Max: if (x.empty()) throw Invalid(); x = { *std::max_element(x.begin(), x.end()) }; break;
+                case Exp: x = apply(x, [](double v) { return std::exp(v); }); break;
+                case Log: x = apply(x, [](double v) { return std::log(v); }); break;
+                case Sqrt: x = apply(x, [](double v) { return std::sqrt(v); }); break;
+                default: x = apply(x, [](double v) { return std::abs(v); });
+
+            }
+
+            // Drop the other arguments
+            stack.resize(stack.size() - op.nargs + 1u);
+            continue;
+
+        }
+
+        // Binary operators
+        std::vector<double> b = stack.back();
+        stack.pop_back();
+        std::vector<double> &a = stack.back();
+
+        switch (op.code) {
+            case Op::Add: a = combine(a, b, [](double x, double y) { return x + y; }); break;
+            case Op::Sub: a = combine(a, b, [](double x, double y) { return x - y; }); break;
+            case Op::Mul: a = combine(a, b, [](double x, double y) { return x * y; }); break;
+            case Op::Div: a = combine(a, b, [](double x, double y) { return x / y; }); break;
+            default: a = combine(a, b, [](double x, double y) { return std::pow(x, y); });
+        }
+    }
+
+    // Check
+    assert(stack.size() == 1u);
+
+    return stack.back();
+
+}
+
+// Function to evaluate all the parameters
+ParSet ParGraph::evaluate() const {
+
+    // Values of each parameter
+    std::vector<std::vector<double>> values(nodes.size());
+
+    // Evaluate each parameter once, after those it depends on
+    for (const size_t &i : order) {
+
+        // Run its program
+        try {
+            values[i] = run(nodes[i], values);
+        } catch (const Invalid&) {
+            throw std::runtime_error(errorExpression(nodes[i]));
+        }
+
+        // Check the result
+        if (values[i].empty()) throw std::runtime_error(errorExpression(nodes[i]));
+        for (const double &x : values[i])
+            if (!std::isfinite(x)) throw std::runtime_error(errorExpression(nodes[i]));
+
+    }
+
+    // Store them in file order
+    ParBuilder builder(filename);
+    for (size_t i = 0u; i < nodes.size(); ++i) builder.add(nodes[i].name, values[i], nodes[i].line);
+
+    return builder.build();
+
+}
@@ -0,0 +1,104 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARGRAPH_HPP
+#define READPARS_PARGRAPH_HPP
+
+// This header contains the ParGraph class, a parameter file in which
+// values can be computed from other parameters, e.g.:
+//
+//   tend 1000
+//   tsave tend / 100
+//   ngenes 4
+//   genes rep(1.0, ngenes)
+//
+// Note: Each expression is compiled once into a short program for a stack
+// machine, and the references between parameters form a graph that is
+// sorted once, so that evaluating the file computes each parameter exactly
+// once, after the parameters it depends on (whatever their order in the
+// file). References that form a cycle are reported as errors.
+
+// Note: Expressions can use numbers, names of other parameters, the
+// operators + - * / ^ and parentheses, and the functions rep(x, n),
+// sum(x), min(x), max(x), exp(x), log(x), sqrt(x) and abs(x). Since all
+// parameters are vectors, operators work value by value, a single value
+// being combined with every value of the other side. Lines made of plain
+// numbers are read as in any other parameter file.
+
+#include "parset.hpp"
+
+class ParGraph {
+
+public:
+
+    // Constructor
+    ParGraph();
+
+    // Setters
+    void load(const std::string&);
+
+    // Getters
+    size_t size() const { return nodes.size(); }
+    std::string getname(const size_t &i) const { return nodes[i].name; }
+    const std::vector<size_t>& getorder() const { return order; }
+    ParSet evaluate() const;
+
+    // Instruction of the stack machine
+    struct Op {
+
+        // What it does
+        enum Code { Number, Param, Neg, Add, Sub, Mul, Div, Pow, Call } code;
+
+        // Index of the number, parameter or function involved
+        size_t arg;
+
+        // Number of arguments of the function
+        size_t nargs;
+
+    };
+
+    // Functions available in expressions
+    enum Function { Rep, Sum, Min, Max, Exp, Log, Sqrt, Abs };
+
+private:
+
+    // Parameter in the graph
+    struct Node {
+
+        std::string name;
+        size_t line;
+        std::vector<Op> code;
+        std::vector<double> numbers;
+        std::vector<std::string> refs;
+        std::vector<size_t> deps;
+
+    };
+
+    // Members
+    std::string filename;
+    std::vector<Node> nodes;
+    std::vector<size_t> order;
+
+    // Private setters
+    void link();
+    void sort();
+
+    // Private getters
+    std::vector<double> run(const Node&, const std::vector<std::vector<double>>&) const;
+
+    // Error messages
+    std::string errorExpression(const Node&) const;
+    std::string errorUnknown(const Node&, const std::string&) const;
+    std::string errorCircular(const Node&) const;
+
+};
+
+#endif
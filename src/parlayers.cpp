@@ -0,0 +1,222 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParLayers class.
+
+#include "parlayers.hpp"
+
+#include <cstdlib>
+
+#ifdef _WIN32
+#define environ _environ
+#else
+extern char **environ;
+#endif
+
+// Constructor
+ParLayers::ParLayers(const ParSet &base) :
+    layers(std::vector<ParSet>(1u, base))
+{
+
+    // base: set of parameters to override
+
+}
+
+// Function to add a set of overrides
+void ParLayers::addset(const ParSet &pars) {
+
+    // pars: set of parameters overriding the previous layers
+
+    // Add on top
+    layers.push_back(pars);
+
+}
+
+// Function to add an override file
+void ParLayers::addfile(const std::string &filename) {
+
+    // filename: name of the file with the overrides
+
+    // Parse it
+    ParSet pars;
+    pars.load(filename);
+
+    // Add on top
+    addset(pars);
+
+}
+
+// Function to add overrides from environment variables
+void ParLayers::addenv(const std::string &prefix) {
+
+    // prefix: prefix of the variables to use (e.g. READPARS_ for READPARS_mutrate)
+
+    // Check
+    assert(!prefix.empty());
+
+    // Prepare to store the overrides
+    ParBuilder builder(prefix, ParSet::Variable);
+
+    // For each environment variable...
+    for (char **var = environ; var && *var; ++var) {
+
+        // Content (NAME=VALUE)
+        const std::string text(*var);
+
+        // Skip if not ours
+        if (text.compare(0u, prefix.size(), prefix) != 0) continue;
+
+        // Parse what comes after the prefix
+        assign(builder, text.substr(prefix.size()), "variable " + text.substr(0u, text.find('=')), 0u);
+
+    }
+
+    // Add on top
+    addset(builder.build());
+
+}
+
+// Function to add overrides from command line arguments
+void ParLayers::addargs(const int &argc, const char* const* argv) {
+
+    // argc: number of arguments (including the name of the program)
+    // argv: arguments, each of the form name=value
+
+    // Prepare to store the overrides
+    ParBuilder builder("command line", ParSet::Argument);
+
+    // For each argument (skipping the name of the program)...
+    for (int i = 1; i < argc; ++i)
+        assign(builder, argv[i], "argument " + std::to_string(i), static_cast<size_t>(i));
+
+    // Add on top
+    addset(builder.build());
+
+}
+
+// Function to parse a name=value assignment into a builder
+void ParLayers::assign(ParBuilder &builder, const std::string &text, const std::string &source, const size_t &position) const {
+
+    // builder: where to store the parameter
+    // text: assignment to parse (e.g. genes=1,2,3)
+    // source: where the assignment comes from (for error messages)
+    // position: position of the assignment (for command line arguments)
+
+    // Split the name from the values
+    const size_t equal = text.find('=');
+
+    // Error message
+    const std::string error = "Invalid assignment " + text + " in " + source;
+
+    // Check
+    if (equal == std::string::npos || equal == 0u) throw std::runtime_error(error);
+
+    // Name
+    const std::string name = text.substr(0u, equal);
+
+    // Check
+    if (!ReadPars::isvalid(name)) throw std::runtime_error(error);
+
+    // Prepare to store the values
+    std::vector<double> values;
+
+    // Start of the next value
+    size_t start = equal + 1u;
+
+    // For each value (separated by commas or spaces)...
+    while (start <= text.size()) {
+
+        // End of the value
+        size_t end = text.find_first_of(", ", start);
+        if (end == std::string::npos) end = text.size();
+
+        // Value
+        const std::string token = text.substr(start, end - start);
+
+        // Move on
+        start = end + 1u;
+
+        // Skip repeated separators
+        if (token.empty()) continue;
+
+        // Parse it
+        double x;
+        if (!ReadPars::isvalid(token) || !ReadPars::parse(token, x))
+            throw std::runtime_error("Invalid value type for parameter " + name + " in " + source);
+
+        // Store it
+        values.push_back(x);
+
+    }
+
+    // Check that there was at least one value
+    if (values.empty())
+        throw std::runtime_error("No value for parameter " + name + " in " + source);
+
+    // Record
+    builder.add(name, values, position);
+
+}
+
+// Function to find the last layer defining a parameter
+size_t ParLayers::where(const std::string &name) const {
+
+    // name: name of the parameter
+
+    // From the top down...
+    for (size_t i = layers.size(); i > 0u; --i)
+        if (layers[i - 1u].has(name)) return i - 1u;
+
+    return ParSet::npos;
+
+}
+
+// Function to tell if any layer defines a parameter
+bool ParLayers::has(const std::string &name) const { return where(name) != ParSet::npos; }
+
+// Function to find the layer to read a parameter from
+size_t ParLayers::top(const std::string &name) const {
+
+    // name: name of the parameter
+
+    // Find it
+    const size_t i = where(name);
+
+    // Note: Missing parameters are looked up in the base, which gives the
+    // usual error message.
+
+    return i == ParSet::npos ? 0u : i;
+
+}
+
+// Function to merge all the layers into a single set
+ParSet ParLayers::flatten() const {
+
+    // Prepare to store the parameters
+    ParBuilder builder(layers[0u].getfilename());
+
+    // For each layer...
+    for (size_t l = 0u; l < layers.size(); ++l) {
+
+        // For each parameter in file order...
+        for (size_t i = 0u; i < layers[l].size(); ++i) {
+
+            // Keep only the occurrence that wins
+            const std::string name = layers[l].getname(i);
+            if (where(name) == l && layers[l].find(name) == i)
+                builder.add(layers[l], i);
+
+        }
+    }
+
+    return builder.build();
+
+}
@@ -0,0 +1,101 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARLAYERS_HPP
+#define READPARS_PARLAYERS_HPP
+
+// This header contains the ParLayers class, a view of a base parameter
+// set overridden by a stack of smaller sets (override files, environment
+// variables or command line arguments).
+
+// Note: The base set is shared, not copied, and each override is parsed
+// into its own small set. Looking up a parameter returns its value from
+// the last layer that defines it. This way, runs that share a large base
+// file only pay for parsing their own overrides.
+
+// Note: Errors about a value overridden by an environment variable or a
+// command line argument name the variable (e.g. "in variable READPARS_X")
+// or the argument (e.g. "in argument 3") instead of a line of a file.
+
+#include "parset.hpp"
+
+class ParLayers {
+
+public:
+
+    // Constructor
+    ParLayers(const ParSet&);
+
+    // Setters
+    void addset(const ParSet&);
+    void addfile(const std::string&);
+    void addenv(const std::string&);
+    void addargs(const int&, const char* const*);
+
+    // Getters
+    size_t size() const { return layers.size(); }
+    const ParSet& getlayer(const size_t &i) const { return layers[i]; }
+    bool has(const std::string&) const;
+    size_t where(const std::string&) const;
+    ParSet flatten() const;
+
+    // Function to get a single value
+    template <typename T>
+    void getvalue(
+        const std::string &name,
+        T &value,
+        const std::function<std::string(const T&)> &check = nullptr
+    ) const {
+
+        // name: name of the parameter
+        // value: variable to read into
+        // check: function used to check the value
+
+        // Read from the last layer defining it
+        layers[top(name)].getvalue<T>(name, value, check);
+
+    }
+
+    // Function to get a vector of values
+    template <typename T>
+    void getvalues(
+        const std::string &name,
+        std::vector<T> &values,
+        const size_t &n,
+        const std::function<std::string(const T&)> &check = nullptr,
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) const {
+
+        // name: name of the parameter
+        // values: vector to read into
+        // n: number of values to read
+        // check: function used to check individual values
+        // checks: function used to check the vector of values
+
+        // Read from the last layer defining it
+        layers[top(name)].getvalues<T>(name, values, n, check, checks);
+
+    }
+
+private:
+
+    // Members (base first)
+    std::vector<ParSet> layers;
+
+    // Private getters
+    size_t top(const std::string&) const;
+
+    // Function to parse a name=value assignment into a builder
+    void assign(ParBuilder&, const std::string&, const std::string&, const size_t&) const;
+
+};
+
+#endif
@@ -0,0 +1,100 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParProfile class.
+
+#include "parprofile.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+// Function to get the entry of a parameter
+READPARS_INLINE ParProfile::Entry& ParProfile::getentry(const std::string_view &name) {
+
+    // name: name of the parameter
+
+    // Note: The entry is added if the parameter is new.
+
+    // Look it up
+    const auto [it, isnew] = index.try_emplace(std::string(name), entries.size());
+
+    // Add it if needed
+    if (isnew) entries.push_back(Entry{ it->first });
+
+    return entries[it->second];
+
+}
+
+// Function to forget all parameters
+READPARS_INLINE void ParProfile::clear() {
+
+    // Clear
+    entries.clear();
+    index.clear();
+
+}
+
+// Function to list the parameters from the most to the least costly
+READPARS_INLINE std::vector<ParProfile::Entry> ParProfile::getsorted() const {
+
+    // Copy the entries
+    std::vector<Entry> sorted(entries.begin(), entries.end());
+
+    // Sort them by decreasing total time (ties keep their order)
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Entry &a, const Entry &b) { return a.total() > b.total(); });
+
+    return sorted;
+
+}
+
+// Function to write the profile as a JSON object
+READPARS_INLINE std::string ParProfile::tojson() const {
+
+    // Note: Parameters appear from the most to the least costly, with
+    // times in seconds.
+
+    // Function to add a number
+    std::string json = "{";
+    auto number = [&](const auto &value) {
+        char buffer[32];
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof buffer, value);
+        json.append(buffer, result.ptr);
+    };
+
+    // For each parameter...
+    for (const Entry &entry : getsorted()) {
+
+        // Note: Names are made of allowed characters only (see
+        // ReadPars::isvalid), so they need no escaping.
+
+        // Add its fields
+        if (json.size() > 1u) json += ", ";
+        json += '"';
+        json += entry.name;
+        json += "\": {\"lines\": ";
+        number(entry.lines);
+        json += ", \"values\": ";
+        number(entry.values);
+        json += ", \"convert\": ";
+        number(entry.convert);
+        json += ", \"check\": ";
+        number(entry.check);
+        json += ", \"total\": ";
+        number(entry.total());
+        json += '}';
+
+    }
+
+    json += "}";
+
+    return json;
+
+}
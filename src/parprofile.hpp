@@ -0,0 +1,123 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARPROFILE_HPP
+#define READPARS_PARPROFILE_HPP
+
+// This header contains the ParProfile class, which records, for each
+// parameter read, how many lines and values it had, how long converting
+// its values took and how long the checks given by the user for it ran.
+
+// Note: Where ParStats (see parstats.hpp) tells which phase of reading
+// takes time, a profile tells which parameter does, e.g. to find a check
+// on a long vector that dominates the time taken to read a file.
+
+// Note: A reader only profiles parameters when given a ParProfile with
+// setprofile(). It then looks up the name of each parameter once per line
+// (not once per value), and otherwise only checks a null pointer. The same
+// profile can be given to several readers to add them up.
+
+#include "parschema.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <chrono>
+
+class ParProfile {
+
+public:
+
+    // What is recorded for each parameter
+    struct Entry {
+
+        // Name of the parameter
+        std::string name;
+
+        // Lines and values read
+        size_t lines = 0u;
+        size_t values = 0u;
+
+        // Time spent converting values and running checks (seconds)
+        double convert = 0.0;
+        double check = 0.0;
+
+        // Total time
+        double total() const { return convert + check; }
+
+    };
+
+    // Functions
+    Entry& getentry(const std::string_view&);
+    void clear();
+
+    // Getters
+    size_t size() const { return entries.size(); }
+    const std::deque<Entry>& getentries() const { return entries; }
+    std::vector<Entry> getsorted() const;
+    std::string tojson() const;
+
+    // Timer adding the time it lives to a parameter (if it is profiled)
+    class Timer {
+
+    public:
+
+        // Constructor
+        Timer(Entry *entry, double Entry::*field) : entry(entry), field(field) {
+
+            // entry: parameter to record into (none if null)
+            // field: time to add to
+
+            if (entry) [[unlikely]] start = std::chrono::steady_clock::now();
+
+        }
+
+        // Destructor
+        ~Timer() {
+
+            if (!entry) [[likely]] return;
+            const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+            entry->*field += time.count();
+
+        }
+
+        // Not to be copied
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+    private:
+
+        // Members
+        Entry *entry;
+        double Entry::*field;
+        std::chrono::steady_clock::time_point start;
+
+    };
+
+private:
+
+    // Parameters in order of first appearance (a deque, so readers can
+    // keep pointers to entries while other entries are added)
+    std::deque<Entry> entries;
+
+    // Position of each parameter in the list
+    std::unordered_map<std::string, size_t> index;
+
+};
+
+// Source code, in the header-only configuration
+#ifdef READPARS_HEADER_ONLY
+#include "parprofile.cpp"
+#endif
+
+#endif
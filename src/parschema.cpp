@@ -0,0 +1,169 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParSchema class.
+
+#include "parschema.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+// Constructor
+READPARS_INLINE ParSchema::ParSchema() :
+    names(std::vector<std::string>()),
+    defaults(std::vector<std::vector<double>>()),
+    required(std::vector<uint64_t>()),
+    slots(std::vector<Slot>())
+{}
+
+// Constructor with required parameters
+READPARS_INLINE ParSchema::ParSchema(const std::initializer_list<std::string> &list) :
+    ParSchema()
+{
+
+    // list: names of the parameters, in order of their ids
+
+    // Register them
+    for (const std::string &name : list) add(name);
+
+}
+
+// Function to hash a name
+READPARS_INLINE uint64_t ParSchema::hash(const std::string_view &name) {
+
+    // name: name to hash
+
+    // Note: This is FNV-1a, which is fast on short names like ours.
+
+    // Start
+    uint64_t h = 0xcbf29ce484222325ull;
+
+    // Mix in each character
+    for (char c : name) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 0x100000001b3ull;
+    }
+
+    return h;
+
+}
+
+// Function to place a parameter in the hash table
+READPARS_INLINE void ParSchema::place(const uint64_t &h, const size_t &id) {
+
+    // h: hash of its name
+    // id: id of the parameter
+
+    // Mask of the table (its size being a power of two)
+    const size_t mask = slots.size() - 1u;
+
+    // Find the first empty slot from its home
+    size_t i = h & mask;
+    while (slots[i].id != npos) i = (i + 1u) & mask;
+
+    // Fill it
+    slots[i] = { h, id };
+
+}
+
+// Function to register a parameter
+READPARS_INLINE size_t ParSchema::insert(const std::string &name, const bool &isrequired) {
+
+    // name: name of the parameter
+    // isrequired: whether the parameter must appear in the file
+
+    // Check
+    if (find(name) != npos) throw std::runtime_error("Parameter " + name + " registered twice");
+
+    // Id of the parameter
+    const size_t id = names.size();
+
+    // Register it
+    names.push_back(name);
+    defaults.push_back(std::vector<double>());
+
+    // Grow the hash table if it would be more than half full
+    if (2u * names.size() > slots.size()) {
+
+        // Twice as big (at least sixteen slots)
+        slots.assign(std::max<size_t>(16u, 2u * slots.size()), { 0u, npos });
+
+        // Place everything again
+        for (size_t j = 0u; j < names.size(); ++j) place(hash(names[j]), j);
+
+    } else {
+
+        // Or just place the new one
+        place(hash(name), id);
+
+    }
+
+    // Make room for its bit if needed
+    if (id % 64u == 0u) required.push_back(0u);
+
+    // Set it
+    if (isrequired) required.back() |= uint64_t(1u) << (id % 64u);
+
+    return id;
+
+}
+
+// Function to register a required parameter
+READPARS_INLINE size_t ParSchema::add(const std::string &name) {
+
+    // name: name of the parameter
+
+    return insert(name, true);
+
+}
+
+// Function to register a parameter with default values
+READPARS_INLINE size_t ParSchema::add(const std::string &name, const std::vector<double> &values) {
+
+    // name: name of the parameter
+    // values: values used when the parameter is not in the file
+
+    // Register it
+    const size_t id = insert(name, false);
+
+    // Remember its defaults
+    defaults[id] = values;
+
+    return id;
+
+}
+
+// Function to find the id of a parameter
+READPARS_INLINE size_t ParSchema::find(const std::string_view &name) const {
+
+    // name: name of the parameter
+
+    // Nothing registered yet
+    if (slots.empty()) return npos;
+
+    // Hash the name
+    const uint64_t h = hash(name);
+
+    // Mask of the table
+    const size_t mask = slots.size() - 1u;
+
+    // Probe from its home until an empty slot
+    for (size_t i = h & mask; slots[i].id != npos; i = (i + 1u) & mask) {
+
+        // Names are only compared when the hashes match
+        if (slots[i].hash == h && names[slots[i].id] == name) return slots[i].id;
+
+    }
+
+    return npos;
+
+}
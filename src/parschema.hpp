@@ -0,0 +1,102 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARSCHEMA_HPP
+#define READPARS_PARSCHEMA_HPP
+
+// This header contains the ParSchema class, the list of parameters a
+// program expects, each with an integer id (its position in the list),
+// and whether it is required or has default values.
+
+// Note: Names are looked up in a hash table built as parameters are
+// registered (open addressing, at most half full), which stores the hash
+// of each name next to its id. Looking up a name thus costs one hash and,
+// almost always, a single comparison of names, however many parameters
+// there are. Since ids are given in order of registration, a program can
+// name them in an enum and switch on the id returned by readline().
+
+// Note: When a reader is given a schema, it records which parameters it
+// has seen in a bitset indexed by id (one bit per parameter), so a name
+// appearing twice is caught on the spot, and the parameters that are
+// missing or left to their defaults are found at the end with a few
+// operations on whole words of bits.
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <initializer_list>
+
+// Functions of the core are inline in the header-only configuration
+// (see readpars.hpp)
+#ifdef READPARS_HEADER_ONLY
+#define READPARS_INLINE inline
+#else
+#define READPARS_INLINE
+#endif
+
+class ParSchema {
+
+public:
+
+    // Constructors
+    ParSchema();
+    ParSchema(const std::initializer_list<std::string>&);
+
+    // Setters
+    size_t add(const std::string&);
+    size_t add(const std::string&, const std::vector<double>&);
+
+    // Getters
+    size_t size() const { return names.size(); }
+    size_t find(const std::string_view&) const;
+    std::string getname(const size_t &id) const { return names[id]; }
+    bool isrequired(const size_t &id) const { return (required[id / 64u] >> (id % 64u)) & 1u; }
+    const std::vector<double>& getdefault(const size_t &id) const { return defaults[id]; }
+    const std::vector<uint64_t>& getrequired() const { return required; }
+
+    // Value returned when a parameter is not found
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+private:
+
+    // Members
+    std::vector<std::string> names;
+    std::vector<std::vector<double>> defaults;
+    std::vector<uint64_t> required;
+
+    // Slot of the hash table
+    struct Slot {
+
+        uint64_t hash;
+        size_t id;
+
+    };
+
+    // Hash table (empty slots have id npos)
+    std::vector<Slot> slots;
+
+    // Private setters
+    size_t insert(const std::string&, const bool&);
+    void place(const uint64_t&, const size_t&);
+
+    // Function to hash a name
+    static uint64_t hash(const std::string_view&);
+
+};
+
+// Source code, in the header-only configuration
+#ifdef READPARS_HEADER_ONLY
+#include "parschema.cpp"
+#endif
+
+#endif
@@ -0,0 +1,807 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParSet and ParBuilder classes.
+
+#include "parset.hpp"
+#include "parcache.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <algorithm>
+#include <fstream>
+#include <filesystem>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Layout of a snapshot (all offsets in bytes from the start of the buffer,
+// so the snapshot can be moved around or sent to another process as is):
+//
+//   Header
+//   Record x nentries (one per parameter, in file order)
+//   Index x nentries (record numbers sorted by name, for lookups)
+//   Character pool (file name and parameter names)
+//   Value blocks (one per parameter, aligned on eight bytes)
+//
+// Each record also tells where the parameter comes from: a line of a file
+// (its line number), a command line argument (its position, in place of
+// the line number) or an environment variable (the prefix of the variable
+// is then stored just before the name in the character pool, and its
+// length in place of the line number).
+//
+// Values are stored in binary form according to the type tag of their
+// record (double, 64-bit signed or unsigned integer, or one-byte boolean),
+// in the byte order of the machine that wrote them. The same layout is
+// used for binary parameter files, which can then be mapped into memory
+// and read without any parsing.
+
+namespace {
+
+    // Snapshot header
+    struct Header {
+
+        char magic[4];
+        uint32_t version;
+        uint64_t nentries;
+        uint64_t filename;
+        uint64_t nfilename;
+        uint64_t index;
+        uint64_t size;
+
+    };
+
+    // Parameter record
+    struct Record {
+
+        uint64_t name;
+        uint64_t nname;
+        uint64_t line;
+        uint32_t tag;
+        uint32_t origin;
+        uint64_t values;
+        uint64_t count;
+
+    };
+
+    // Identification
+    const char magic[4] = { 'R', 'D', 'P', 'S' };
+    const uint32_t version = 1u;
+
+    // Function to tell the size of a stored value
+    uint64_t sizeoftype(const uint32_t &tag) { return tag == ParSet::Boolean ? 1u : 8u; }
+
+    // Function to round up to the next multiple of eight
+    uint64_t align(const uint64_t &x) { return (x + 7u) & ~uint64_t(7u); }
+
+    // Function to access the header of a snapshot
+    const Header& header(const char *base) { return *reinterpret_cast<const Header*>(base); }
+
+    // Function to access a record of a snapshot
+    const Record& record(const char *base, const size_t &i) {
+
+        // base: start of the snapshot
+        // i: index of the record
+
+        return reinterpret_cast<const Record*>(base + sizeof(Header))[i];
+
+    }
+
+    // Function to access the name of a record
+    std::string_view name(const char *base, const Record &r) { return std::string_view(base + r.name, r.nname); }
+
+}
+
+// Constructor
+ParSet::ParSet() :
+    owner(nullptr),
+    base(nullptr),
+    length(0u)
+{}
+
+// Constructor from a snapshot
+ParSet::ParSet(std::vector<char> &&buffer) :
+    owner(nullptr),
+    base(nullptr),
+    length(0u)
+{
+
+    // buffer: serialized snapshot to take ownership of
+
+    // Take ownership (the values are not copied)
+    auto storage = std::make_shared<const std::vector<char>>(std::move(buffer));
+
+    // Point to it
+    adopt(storage, storage->data(), storage->size());
+
+}
+
+// Error messages
+std::string ParSet::errorMissing(const std::string &name) const { return "Missing parameter " + name + " in file " + getfilename(); }
+std::string ParSet::errorParseValue(const size_t &i) const { return "Invalid value type for parameter " + getname(i) + where(i); }
+std::string ParSet::errorTooManyValues(const size_t &i) const { return "Too many values for parameter " + getname(i) + where(i); }
+std::string ParSet::errorTooFewValues(const size_t &i) const { return "Too few values for parameter " + getname(i) + where(i); }
+
+// Function to tell where a parameter comes from (for error messages)
+std::string ParSet::where(const size_t &i) const {
+
+    // i: index of the parameter
+
+    switch (getorigin(i)) {
+        case Variable: return " in variable " + getvariable(i);
+        case Argument: return " in argument " + std::to_string(getargument(i));
+        default: return " in line " + std::to_string(getline(i)) + " of file " + getfilename();
+    }
+}
+
+// Function to format error message
+void ParSet::checkerror(const size_t &i, const std::string &error) const {
+
+    // i: index of the parameter
+    // error: error message to format
+
+    // Check if error is empty
+    if (error.empty()) return;
+
+    // Or format the error message
+    std::string message = "Parameter " + getname(i) + " " + error + where(i);
+
+    // And throw exception
+    throw std::runtime_error(message);
+
+}
+
+// Function to point to a snapshot
+void ParSet::adopt(std::shared_ptr<const void> storage, const char *data, const size_t &size) {
+
+    // storage: object keeping the snapshot alive
+    // data: start of the snapshot
+    // size: size of the snapshot in bytes
+
+    // Error message
+    const std::string error = "Invalid parameter snapshot";
+
+    // Check that the header fits
+    if (size < sizeof(Header)) throw std::runtime_error(error);
+
+    // Check alignment
+    if (reinterpret_cast<uintptr_t>(data) % alignof(Header) != 0u)
+        throw std::runtime_error(error);
+
+    // Header
+    const Header &h = header(data);
+
+    // Check identification
+    if (std::memcmp(h.magic, magic, 4u) != 0 || h.version != version || h.size != size)
+        throw std::runtime_error(error);
+
+    // Check that the tables fit
+    if (h.nentries > (size - sizeof(Header)) / (sizeof(Record) + sizeof(uint64_t)))
+        throw std::runtime_error(error);
+
+    // Check that the index and file name fit
+    if (h.index > size || h.index % 8u != 0u || h.nentries > (size - h.index) / sizeof(uint64_t) ||
+        h.filename > size || h.nfilename > size - h.filename)
+        throw std::runtime_error(error);
+
+    // For each record...
+    for (size_t i = 0u; i < h.nentries; ++i) {
+
+        // Record
+        const Record &r = record(data, i);
+
+        // Check that its name and values fit
+        if (r.name > size || r.nname > size - r.name || r.tag > ParSet::Boolean ||
+            r.origin > ParSet::Argument || (r.origin == ParSet::Variable && r.line > r.name) ||
+            r.values > size || r.values % 8u != 0u || r.count > (size - r.values) / sizeoftype(r.tag))
+            throw std::runtime_error(error);
+
+    }
+
+    // Sorted index
+    const uint64_t *index = reinterpret_cast<const uint64_t*>(data + h.index);
+
+    // Check that it only points to existing records
+    for (size_t i = 0u; i < h.nentries; ++i)
+        if (index[i] >= h.nentries) throw std::runtime_error(error);
+
+    // Note: Lookups search the index by binary search, so it must be sorted
+    // by name, with repeated names in file order (see find()).
+
+    // Check that it is sorted
+    for (size_t i = 1u; i < h.nentries; ++i) {
+        const std::string_view a = name(data, record(data, index[i - 1u]));
+        const std::string_view b = name(data, record(data, index[i]));
+        if (b < a || (a == b && index[i] <= index[i - 1u])) throw std::runtime_error(error);
+    }
+
+    // Note: Any byte other than zero or one is not a valid bool.
+
+    // Check that Boolean values are zeros and ones
+    for (size_t i = 0u; i < h.nentries; ++i) {
+        const Record &r = record(data, i);
+        if (r.tag != ParSet::Boolean) continue;
+        for (size_t j = 0u; j < r.count; ++j)
+            if (static_cast<unsigned char>(data[r.values + j]) > 1u) throw std::runtime_error(error);
+    }
+
+    // Point to the snapshot
+    owner = storage;
+    base = data;
+    length = size;
+
+}
+
+// Files being loaded by the current thread, innermost last
+static thread_local std::vector<std::string> loading;
+
+// Remember that a file is being loaded, until we are done with it
+ParBuilder::Loading::Loading(const std::string &filename) { loading.push_back(std::filesystem::weakly_canonical(filename).string()); }
+ParBuilder::Loading::~Loading() { loading.pop_back(); }
+
+// Function to load a parameter file
+void ParSet::load(const std::string &filename) {
+
+    // filename: name of the file to read
+
+    // Prepare to read and store
+    ReadPars reader(filename);
+    ParBuilder builder(filename);
+
+    // Open the file
+    reader.open();
+
+    // Remember that we are loading it, until we are done (so that files
+    // including each other can be detected)
+    const ParBuilder::Loading done(filename);
+
+    // For each line in the file...
+    while (!reader.iseof()) {
+
+        // Read a line
+        reader.readline();
+
+        // Skip empty and comment lines
+        if (reader.isempty() || reader.iscomment()) continue;
+
+        // Record the parameter
+        builder.readline(reader);
+
+    }
+
+    // Close the file
+    reader.close();
+
+    // Replace the content
+    *this = builder.build();
+
+}
+
+// Function to map a binary parameter file into memory
+void ParSet::map(const std::string &filename) {
+
+    // filename: name of the binary file
+
+    // Error message
+    const std::string error = "Unable to open file " + filename;
+
+#ifndef _WIN32
+
+    // Open the file
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error(error);
+
+    // Size of the file
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error(error);
+    }
+
+    // Map it
+    const size_t size = static_cast<size_t>(info.st_size);
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after closing the file
+    ::close(fd);
+
+    // Check
+    if (data == MAP_FAILED) throw std::runtime_error(error);
+
+    // Unmap when the last copy of the set goes away
+    std::shared_ptr<const void> storage(data, [size](const void *p) {
+        ::munmap(const_cast<void*>(p), size);
+    });
+
+    // Point to it
+    adopt(storage, static_cast<const char*>(data), size);
+
+#else
+
+    // Note: Without memory mapping the file is read in one go instead.
+
+    // Open the file
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) throw std::runtime_error(error);
+
+    // Read it
+    std::vector<char> buffer(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(buffer.data(), buffer.size());
+
+    // Take ownership
+    *this = ParSet(std::move(buffer));
+
+#endif
+
+}
+
+// Function to save the set into a binary parameter file
+void ParSet::save(const std::string &filename) const {
+
+    // filename: name of the binary file
+
+    // Open the file
+    std::ofstream file(filename, std::ios::binary);
+
+    // Check
+    if (!file.is_open())
+        throw std::runtime_error("Unable to open file " + filename);
+
+    // Write the snapshot as is
+    file.write(base, static_cast<std::streamsize>(length));
+    file.close();
+
+    // Check that it was written
+    if (file.fail())
+        throw std::runtime_error("Unable to write file " + filename);
+
+}
+
+// Number of parameters
+size_t ParSet::size() const { return base ? header(base).nentries : 0u; }
+
+// Name of the file the parameters come from
+std::string ParSet::getfilename() const {
+
+    // Empty set
+    if (!base) return "";
+
+    // Header
+    const Header &h = header(base);
+
+    return std::string(base + h.filename, h.nfilename);
+
+}
+
+// Name of a parameter
+std::string ParSet::getname(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    return std::string(name(base, record(base, i)));
+
+}
+
+// Line number of a parameter
+size_t ParSet::getline(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    // Record
+    const Record &r = record(base, i);
+
+    // Note: Parameters that do not come from a file have no line number.
+
+    return r.origin == File ? r.line : 0u;
+
+}
+
+// Where a parameter comes from
+ParSet::Origin ParSet::getorigin(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    return static_cast<Origin>(record(base, i).origin);
+
+}
+
+// Command line argument a parameter comes from
+size_t ParSet::getargument(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    // Record
+    const Record &r = record(base, i);
+
+    return r.origin == Argument ? r.line : 0u;
+
+}
+
+// Environment variable a parameter comes from
+std::string ParSet::getvariable(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    // Record
+    const Record &r = record(base, i);
+
+    // Not from a variable
+    if (r.origin != Variable) return "";
+
+    // The prefix comes just before the name
+    return std::string(base + r.name - r.line, r.line + r.nname);
+
+}
+
+// Number of values of a parameter
+size_t ParSet::getcount(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    return record(base, i).count;
+
+}
+
+// Type of the values of a parameter
+ParSet::Type ParSet::gettype(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    return static_cast<Type>(record(base, i).tag);
+
+}
+
+// Stored values of a parameter
+const char* ParSet::getblock(const size_t &i) const {
+
+    // i: index of the parameter
+
+    // Check
+    assert(i < size());
+
+    return base + record(base, i).values;
+
+}
+
+// Index of the k-th parameter in alphabetical order
+size_t ParSet::getsorted(const size_t &k) const {
+
+    // k: rank of the parameter in alphabetical order
+
+    // Check
+    assert(k < size());
+
+    // Note: Ties (repeated names) are ranked in file order.
+
+    return reinterpret_cast<const uint64_t*>(base + header(base).index)[k];
+
+}
+
+// Function to find a parameter by name
+size_t ParSet::find(const std::string &key) const {
+
+    // key: name of the parameter
+
+    // Empty set
+    if (!base) return npos;
+
+    // Sorted index
+    const Header &h = header(base);
+    const uint64_t *first = reinterpret_cast<const uint64_t*>(base + h.index);
+    const uint64_t *last = first + h.nentries;
+
+    // Find the end of the range of records with that name
+    const uint64_t *it = std::upper_bound(first, last, std::string_view(key),
+        [&](const std::string_view &k, const uint64_t &j) { return k < name(base, record(base, j)); }
+    );
+
+    // Not found
+    if (it == first || name(base, record(base, *(it - 1))) != key) return npos;
+
+    // Note: If a parameter appears more than once, the last occurrence wins,
+    // as it would when reading the file line by line into variables.
+
+    return *(it - 1);
+
+}
+
+// Function to find a parameter or throw
+size_t ParSet::locate(const std::string &name) const {
+
+    // name: name of the parameter
+
+    // Find it
+    const size_t i = find(name);
+
+    // Error if missing
+    if (i == npos)
+        throw std::runtime_error(errorMissing(name));
+
+    return i;
+
+}
+
+// Constructor
+ParBuilder::ParBuilder(const std::string &filename, const ParSet::Origin &origin) :
+    filename(filename),
+    origin(origin),
+    entries(std::vector<Entry>()),
+    pool(std::vector<char>())
+{
+
+    // filename: name of the file the parameters come from
+    // origin: where the parameters come from
+
+    // Note: For environment variables, the file name is the prefix of the
+    // variables, and for command line arguments, line numbers are their
+    // positions.
+
+}
+
+// Function to add a parameter
+void ParBuilder::add(const std::string &name, const std::vector<double> &x, const size_t &line) {
+
+    // name: name of the parameter
+    // x: values of the parameter
+    // line: line number in the file
+
+    // Store as doubles
+    add<double>(name, x, line);
+
+}
+
+// Function to copy a parameter from another set
+void ParBuilder::add(const ParSet &pars, const size_t &i) {
+
+    // pars: set to copy from
+    // i: index of the parameter
+
+    // Size of the stored values
+    const size_t n = pars.getcount(i) * sizeoftype(pars.gettype(i));
+
+    // Start of the block, aligned on eight bytes
+    const size_t offset = align(pool.size());
+
+    // Name of the variable it comes from, if any
+    const std::string variable = pars.getvariable(i);
+    const std::string name = pars.getname(i);
+
+    // Record (keeping where it comes from)
+    const ParSet::Origin from = pars.getorigin(i);
+    const size_t line = from == ParSet::Argument ? pars.getargument(i) : pars.getline(i);
+    entries.push_back({ name, line, pars.gettype(i), offset, pars.getcount(i), from, variable.substr(0u, variable.size() - name.size()) });
+
+    // Copy the values as they are
+    pool.resize(offset + n);
+    if (n) std::memcpy(pool.data() + offset, pars.getblock(i), n);
+
+}
+
+// Function to add all the parameters of another set
+void ParBuilder::include(const ParSet &pars, const size_t &line) {
+
+    // pars: set to copy from
+    // line: line number to give all its parameters
+
+    // For each parameter in file order...
+    for (size_t i = 0u; i < pars.size(); ++i) {
+
+        // Copy it
+        add(pars, i);
+
+        // From the given line of the including file
+        entries.back().line = line;
+        entries.back().origin = ParSet::File;
+        entries.back().prefix.clear();
+
+    }
+}
+
+// Function to follow an include directive
+void ParBuilder::include(ReadPars &reader) {
+
+    // reader: reader whose current line is the directive
+
+    namespace fs = std::filesystem;
+
+    // Location of the directive
+    const std::string location = " in line " + std::to_string(reader.getcount()) + " of file " + reader.getfilename();
+
+    // Read the name of the file to include
+    std::string path;
+    reader.readvalue<std::string>(path);
+
+    // Relative paths start from the folder of the including file
+    fs::path target(path);
+    if (target.is_relative()) target = fs::path(reader.getfilename()).parent_path() / target;
+
+    // Check for circular inclusions
+    const std::string canonical = fs::weakly_canonical(target).string();
+    if (std::find(loading.begin(), loading.end(), canonical) != loading.end())
+        throw std::runtime_error("Circular inclusion of file " + target.string() + location);
+
+    // Parse it (only once per process) and add its parameters
+    include(ParCache::global().load(target.string()), reader.getcount());
+
+}
+
+// Function to record the current line of a reader
+void ParBuilder::readline(ReadPars &reader) {
+
+    // reader: reader whose current line to record
+
+    // Include directives pull in the content of another file
+    if (reader.getname() == "include") {
+        include(reader);
+        return;
+    }
+
+    // Note: Lines of whole numbers written in full are stored as integers
+    // (signed if they fit, unsigned otherwise), so that they are read back
+    // exactly, as they would be from the file, and not through a double.
+
+    // Values on the line
+    const std::string rest = reader.getrest();
+
+    // Try to read them all as integers
+    std::vector<int64_t> xi;
+    std::vector<uint64_t> xu;
+    bool integers = true, isunsigned = false;
+    for (size_t cursor = 0u; integers;) {
+
+        // Next word
+        const std::string_view word = ReadPars::nextword(rest, cursor);
+        if (word.empty()) break;
+
+        // Signed if possible, unsigned otherwise
+        int64_t y;
+        uint64_t z;
+        if (!isunsigned && ReadPars::parseint(word, y)) xi.push_back(y);
+        else if (ReadPars::parseint(word, z)) {
+
+            // Switch to unsigned (only if no value so far was negative)
+            if (!isunsigned) {
+                integers = std::all_of(xi.begin(), xi.end(), [](const int64_t &v) { return v >= 0; });
+                xu.assign(xi.begin(), xi.end());
+                isunsigned = true;
+            }
+
+            xu.push_back(z);
+
+        }
+        else integers = false;
+
+    }
+
+    // Record them if they are all integers
+    if (integers && isunsigned) { add<uint64_t>(reader.getname(), xu, reader.getcount()); return; }
+    if (integers && !xi.empty()) { add<int64_t>(reader.getname(), xi, reader.getcount()); return; }
+
+    // Otherwise read all the values on the line as numbers
+    std::vector<double> x;
+    reader.readall(x);
+
+    // Record
+    add(reader.getname(), x, reader.getcount());
+
+}
+
+// Function to assemble the snapshot
+ParSet ParBuilder::build() const {
+
+    // Number of parameters
+    const uint64_t n = entries.size();
+
+    // Offsets of the different sections
+    const uint64_t irecords = sizeof(Header);
+    const uint64_t iindex = irecords + n * sizeof(Record);
+    const uint64_t ichars = iindex + n * sizeof(uint64_t);
+
+    // Size of the character pool
+    uint64_t nchars = filename.size();
+    for (const Entry &e : entries) nchars += e.prefix.size() + e.name.size();
+
+    // Offset of the value blocks
+    const uint64_t ivalues = align(ichars + nchars);
+
+    // Total size
+    const uint64_t size = ivalues + pool.size();
+
+    // Allocate
+    std::vector<char> buffer(size, '\0');
+    char *base = buffer.data();
+
+    // Header
+    Header h;
+    std::memcpy(h.magic, magic, 4u);
+    h.version = version;
+    h.nentries = n;
+    h.filename = ichars;
+    h.nfilename = filename.size();
+    h.index = iindex;
+    h.size = size;
+    std::memcpy(base, &h, sizeof(Header));
+
+    // File name
+    std::memcpy(base + ichars, filename.data(), filename.size());
+
+    // Position in the character pool
+    uint64_t pos = ichars + filename.size();
+
+    // For each parameter...
+    for (uint64_t i = 0u; i < n; ++i) {
+
+        // Entry
+        const Entry &e = entries[i];
+
+        // Prefix of the variable, if any
+        std::memcpy(base + pos, e.prefix.data(), e.prefix.size());
+        pos += e.prefix.size();
+
+        // Record
+        Record r;
+        r.name = pos;
+        r.nname = e.name.size();
+        r.line = e.origin == ParSet::Variable ? e.prefix.size() : e.line;
+        r.tag = e.type;
+        r.origin = e.origin;
+        r.values = ivalues + e.offset;
+        r.count = e.count;
+        std::memcpy(base + irecords + i * sizeof(Record), &r, sizeof(Record));
+
+        // Name
+        std::memcpy(base + pos, e.name.data(), e.name.size());
+        pos += e.name.size();
+
+    }
+
+    // Values
+    if (!pool.empty())
+        std::memcpy(base + ivalues, pool.data(), pool.size());
+
+    // Sorted index (ties keep file order)
+    std::vector<uint64_t> index(n);
+    for (uint64_t i = 0u; i < n; ++i) index[i] = i;
+    std::stable_sort(index.begin(), index.end(), [&](const uint64_t &a, const uint64_t &b) {
+        return entries[a].name < entries[b].name;
+    });
+    if (n) std::memcpy(base + iindex, index.data(), n * sizeof(uint64_t));
+
+    return ParSet(std::move(buffer));
+
+}
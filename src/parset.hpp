@@ -0,0 +1,461 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARSET_HPP
+#define READPARS_PARSET_HPP
+
+// This header contains the ParSet class, a fully parsed parameter file,
+// and the ParBuilder class used to assemble one.
+
+// Note: A ParSet stores its content as a single contiguous snapshot (see
+// the layout in parset.cpp). Copying a set only copies a shared pointer,
+// and a snapshot received as raw bytes (e.g. from another process) or
+// saved into a binary file can be used as is, without copying or
+// re-parsing the values.
+
+// Note: A line such as "include common.txt" adds all the parameters of
+// another file (relative to the folder of the including file) at that
+// point, so later lines can override them. Included files go through the
+// process-wide cache (see parcache.hpp), so a base shared by many files is
+// parsed only once. Files including each other are reported as errors.
+// The name of the file is read like any other value, so it can only be
+// made of letters, digits, dots and minus signs.
+
+#include "readpars.hpp"
+
+#include <memory>
+#include <limits>
+#include <cstdint>
+#include <span>
+#include <cstring>
+#include <utility>
+
+class ParSet {
+
+public:
+
+    // Types of stored values
+    enum Type : uint32_t { Double, Integer, Unsigned, Boolean };
+
+    // Where parameters come from
+    enum Origin : uint32_t { File, Variable, Argument };
+
+    // Constructors
+    ParSet();
+    ParSet(std::vector<char>&&);
+
+    // Setters
+    void load(const std::string&);
+    void map(const std::string&);
+
+    // Writers
+    void save(const std::string&) const;
+
+    // Getters
+    size_t size() const;
+    size_t find(const std::string&) const;
+    bool has(const std::string &name) const { return find(name) != npos; }
+    std::string getfilename() const;
+    std::string getname(const size_t&) const;
+    size_t getline(const size_t&) const;
+    Origin getorigin(const size_t&) const;
+    size_t getargument(const size_t&) const;
+    std::string getvariable(const size_t&) const;
+    size_t getcount(const size_t&) const;
+    Type gettype(const size_t&) const;
+    const char* getblock(const size_t&) const;
+    size_t getsorted(const size_t&) const;
+
+    // Raw snapshot
+    const char* data() const { return base; }
+    size_t bytes() const { return length; }
+
+    // Value returned when a parameter is not found
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    // Function to get a single value
+    template <typename T>
+    void getvalue(
+        const std::string &name,
+        T &value,
+        const std::function<std::string(const T&)> &check = nullptr
+    ) const {
+
+        // name: name of the parameter
+        // value: variable to read into
+        // check: function used to check the value
+
+        getvalue<T>(locate(name), value, check);
+
+    }
+
+    // Function to get a single value by index
+    template <typename T>
+    void getvalue(
+        const size_t &i,
+        T &value,
+        const std::function<std::string(const T&)> &check = nullptr
+    ) const {
+
+        // i: index of the parameter
+        // value: variable to read into
+        // check: function used to check the value
+
+        // Check
+        assert(i < size());
+
+        // Check that there is exactly one value
+        if (getcount(i) > 1u) throw std::runtime_error(errorTooManyValues(i));
+        if (getcount(i) < 1u) throw std::runtime_error(errorTooFewValues(i));
+
+        // Convert and check
+        get(i, gettype(i), getblock(i), 0u, value, check);
+
+    }
+
+    // Function to get a vector of values
+    template <typename T>
+    void getvalues(
+        const std::string &name,
+        std::vector<T> &values,
+        const size_t &n,
+        const std::function<std::string(const T&)> &check = nullptr,
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) const {
+
+        // name: name of the parameter
+        // values: vector to read into
+        // n: number of values to read
+        // check: function used to check individual values
+        // checks: function used to check the vector of values
+
+        getvalues<T>(locate(name), values, n, check, checks);
+
+    }
+
+    // Function to get a vector of values by index
+    template <typename T>
+    void getvalues(
+        const size_t &i,
+        std::vector<T> &values,
+        const size_t &n,
+        const std::function<std::string(const T&)> &check = nullptr,
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) const {
+
+        // i: index of the parameter
+        // values: vector to read into
+        // n: number of values to read
+        // check: function used to check individual values
+        // checks: function used to check the vector of values
+
+        // Check
+        assert(n != 0);
+        assert(i < size());
+
+        // Check the number of values
+        if (getcount(i) > n) throw std::runtime_error(errorTooManyValues(i));
+        if (getcount(i) < n) throw std::runtime_error(errorTooFewValues(i));
+
+        // Stored values
+        const Type type = gettype(i);
+        const char *block = getblock(i);
+
+        // Resize
+        values.clear();
+        values.reserve(n);
+
+        // For each value...
+        for (size_t j = 0u; j < n; ++j) {
+
+            // Prepare to store the value
+            T value;
+
+            // Convert and check
+            get(i, type, block, j, value, check);
+
+            // Add to the vector
+            values.push_back(value);
+
+        }
+
+        // Check validity (vector level)
+        std::string error = checks ? checks(values) : "";
+
+        // If error, throw
+        checkerror(i, error);
+
+    }
+
+    // Function to view the stored values of a parameter without copying
+    template <typename T>
+    std::span<const T> getview(const std::string &name) const {
+
+        // name: name of the parameter
+
+        // Note: The requested type must be the one the values were stored
+        // with (double, int64_t, uint64_t or bool). No conversion or check
+        // happens here, as those were done when the set was built.
+
+        // Locate the parameter
+        const size_t i = locate(name);
+
+        // Check the type
+        if (gettype(i) != totype<T>())
+            throw std::runtime_error(errorParseValue(i));
+
+        return std::span<const T>(reinterpret_cast<const T*>(getblock(i)), getcount(i));
+
+    }
+
+    // Function to tell the type tag of a C++ type
+    template <typename T>
+    static constexpr Type totype() {
+
+        // Check
+        static_assert(std::is_arithmetic_v<T>, "Parameters must be numbers");
+
+        // Booleans first, as they are also integers
+        if constexpr (std::is_same_v<T, bool>) return Boolean;
+        else if constexpr (std::is_floating_point_v<T>) return Double;
+        else if constexpr (std::is_signed_v<T>) return Integer;
+        else return Unsigned;
+
+    }
+
+private:
+
+    // Snapshot members
+    std::shared_ptr<const void> owner;
+    const char *base;
+    size_t length;
+
+    // Private setters
+    void adopt(std::shared_ptr<const void>, const char*, const size_t&);
+
+    // Private getters
+    size_t locate(const std::string&) const;
+    std::string where(const size_t&) const;
+
+    // Error messages
+    std::string errorMissing(const std::string&) const;
+    std::string errorParseValue(const size_t&) const;
+    std::string errorTooManyValues(const size_t&) const;
+    std::string errorTooFewValues(const size_t&) const;
+
+    // Validity errors
+    void checkerror(const size_t&, const std::string&) const;
+
+    // Function to read a stored value as a number
+    static double number(const Type &type, const char *block, const size_t &j) {
+
+        // type: type of the stored values
+        // block: start of the stored values
+        // j: index of the value
+
+        switch (type) {
+            case Integer: return static_cast<double>(reinterpret_cast<const int64_t*>(block)[j]);
+            case Unsigned: return static_cast<double>(reinterpret_cast<const uint64_t*>(block)[j]);
+            case Boolean: return reinterpret_cast<const bool*>(block)[j] ? 1.0 : 0.0;
+            default: return reinterpret_cast<const double*>(block)[j];
+        }
+    }
+
+    // Function to convert a stored value exactly
+    template <typename T>
+    static bool convert(const Type &type, const char *block, const size_t &j, T &value) {
+
+        // type: type of the stored values
+        // block: start of the stored values
+        // j: index of the value
+        // value: variable to convert into
+
+        // Note: Doubles only hold integers up to 2^53 exactly, so stored
+        // integers are converted into integer types without going through
+        // a double, and only need to be within range.
+
+        // Integers into integers
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            if (type == Integer) {
+                const int64_t x = reinterpret_cast<const int64_t*>(block)[j];
+                if (!std::in_range<T>(x)) return false;
+                value = static_cast<T>(x);
+                return true;
+            }
+            if (type == Unsigned) {
+                const uint64_t x = reinterpret_cast<const uint64_t*>(block)[j];
+                if (!std::in_range<T>(x)) return false;
+                value = static_cast<T>(x);
+                return true;
+            }
+        }
+
+        // Anything else is coerced as a number
+        return ReadPars::coerce(number(type, block, j), value);
+
+    }
+
+    // Function to convert and check a stored value
+    template <typename T>
+    void get(
+        const size_t &i,
+        const Type &type,
+        const char *block,
+        const size_t &j,
+        T &value,
+        const std::function<std::string(const T&)> &check
+    ) const {
+
+        // i: index of the parameter
+        // type: type of the stored values
+        // block: start of the stored values
+        // j: index of the value
+        // value: variable to convert into
+        // check: function used to check the value
+
+        // Convert into the requested type
+        if (!convert(type, block, j, value))
+            throw std::runtime_error(errorParseValue(i));
+
+        // Check validity
+        std::string error = check ? check(value) : "";
+
+        // If error, throw
+        checkerror(i, error);
+
+    }
+
+};
+
+class ParBuilder {
+
+public:
+
+    // Marks a file as being loaded by the current thread while in scope, so
+    // that files including it back are reported as circular
+    struct Loading {
+        Loading(const std::string&);
+        ~Loading();
+        Loading(const Loading&) = delete;
+        Loading& operator=(const Loading&) = delete;
+    };
+
+    // Constructor
+    ParBuilder(const std::string& = "", const ParSet::Origin& = ParSet::File);
+
+    // Setters
+    void add(const std::string&, const std::vector<double>&, const size_t& = 0u);
+    void add(const ParSet&, const size_t&);
+    void include(const ParSet&, const size_t&);
+    void readline(ReadPars&);
+
+    // Getters
+    size_t size() const { return entries.size(); }
+    ParSet build() const;
+
+    // Function to add a parameter with values of a given type
+    template <typename T>
+    void add(const std::string &name, const std::vector<T> &x, const size_t &line = 0u) {
+
+        // name: name of the parameter
+        // x: values of the parameter
+        // line: line number in the file
+
+        // Type of the stored values
+        using U = std::conditional_t<std::is_same_v<T, bool>, bool,
+                  std::conditional_t<std::is_floating_point_v<T>, double,
+                  std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>>;
+
+        // Start of the block, aligned on eight bytes
+        const size_t offset = (pool.size() + 7u) & ~size_t(7u);
+
+        // Record
+        entries.push_back({ name, line, ParSet::totype<T>(), offset, x.size(), origin, origin == ParSet::Variable ? filename : "" });
+
+        // Make room
+        pool.resize(offset + x.size() * sizeof(U));
+
+        // Append the values
+        for (size_t j = 0u; j < x.size(); ++j) {
+            const U y = static_cast<U>(x[j]);
+            std::memcpy(pool.data() + offset + j * sizeof(U), &y, sizeof(U));
+        }
+    }
+
+    // Function to read a single value through a reader and record it
+    template <typename T>
+    void readvalue(
+        ReadPars &reader,
+        const std::function<std::string(const T&)> &check = nullptr
+    ) {
+
+        // reader: reader whose current line to record
+        // check: function used to check the value
+
+        // Read and check the value
+        T value;
+        reader.readvalue<T>(value, check);
+
+        // Record
+        add<T>(reader.getname(), std::vector<T>(1u, value), reader.getcount());
+
+    }
+
+    // Function to read a vector of values through a reader and record it
+    template <typename T>
+    void readvalues(
+        ReadPars &reader,
+        const size_t &n,
+        const std::function<std::string(const T&)> &check = nullptr,
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) {
+
+        // reader: reader whose current line to record
+        // n: number of values to read
+        // check: function used to check individual values
+        // checks: function used to check the vector of values
+
+        // Read and check the values
+        std::vector<T> values;
+        reader.readvalues<T>(values, n, check, checks);
+
+        // Record
+        add<T>(reader.getname(), values, reader.getcount());
+
+    }
+
+private:
+
+    // Parameter entry
+    struct Entry {
+
+        std::string name;
+        size_t line;
+        ParSet::Type type;
+        size_t offset;
+        size_t count;
+        ParSet::Origin origin;
+        std::string prefix;
+
+    };
+
+    // Members
+    std::string filename;
+    ParSet::Origin origin;
+    std::vector<Entry> entries;
+    std::vector<char> pool;
+
+    // Private setters
+    void include(ReadPars&);
+
+};
+
+#endif
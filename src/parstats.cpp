@@ -0,0 +1,60 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParStats structure.
+
+#include "parstats.hpp"
+
+#include <charconv>
+
+// Function to write the statistics as a JSON object
+READPARS_INLINE std::string ParStats::tojson() const {
+
+    // Note: Times are in seconds, written in their shortest exact form.
+
+    // Function to add a field
+    std::string json = "{";
+    auto field = [&](const char *key, const auto &value) {
+        char buffer[32];
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof buffer, value);
+        if (json.size() > 1u) json += ", ";
+        json += '"';
+        json += key;
+        json += "\": ";
+        json.append(buffer, result.ptr);
+    };
+
+    // Times
+    field("io", io);
+    field("split", split);
+    field("validate", validate);
+    field("convert", convert);
+    field("check", check);
+    field("error", error);
+    field("total", total());
+
+    // Amounts
+    field("bytes", bytes);
+    field("lines", lines);
+    field("tokens", tokens);
+    field("errors", errors);
+
+    // Values by type
+    field("booleans", booleans);
+    field("integers", integers);
+    field("reals", reals);
+    field("strings", strings);
+
+    json += "}";
+
+    return json;
+
+}
@@ -0,0 +1,104 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARSTATS_HPP
+#define READPARS_PARSTATS_HPP
+
+// This header contains the ParStats structure, which records where the
+// time of a reader goes (reading the file, splitting lines into words,
+// validating words, converting numbers, running the checks given by the
+// user and formatting error messages), and how much was read.
+
+// Note: A reader only records statistics when given a ParStats with
+// setstats(), and only checks a null pointer otherwise, so readers that
+// are not asked for statistics run at the same speed. The same ParStats
+// can be given to several readers (e.g. one per file) to add them up.
+
+// Note: Phases do not overlap (e.g. the time taken by a check is not
+// counted as conversion), so they add up to the time spent in the reader,
+// minus the small cost of the clock itself.
+
+#include "parschema.hpp"
+
+#include <string>
+#include <chrono>
+
+struct ParStats {
+
+    // Time spent in each phase (seconds)
+    double io = 0.0;
+    double split = 0.0;
+    double validate = 0.0;
+    double convert = 0.0;
+    double check = 0.0;
+    double error = 0.0;
+
+    // Amounts read
+    size_t bytes = 0u;
+    size_t lines = 0u;
+    size_t tokens = 0u;
+    size_t errors = 0u;
+
+    // Values read, by type
+    size_t booleans = 0u;
+    size_t integers = 0u;
+    size_t reals = 0u;
+    size_t strings = 0u;
+
+    // Functions
+    void clear() { *this = ParStats(); }
+    double total() const { return io + split + validate + convert + check + error; }
+    std::string tojson() const;
+
+    // Timer adding the time it lives to a phase (if there are statistics)
+    class Timer {
+
+    public:
+
+        // Constructor
+        Timer(ParStats *stats, double ParStats::*phase) : stats(stats), phase(phase) {
+
+            // stats: statistics to record into (none if null)
+            // phase: phase to add the time to
+
+            if (stats) [[unlikely]] start = std::chrono::steady_clock::now();
+
+        }
+
+        // Destructor
+        ~Timer() {
+
+            if (!stats) [[likely]] return;
+            const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+            stats->*phase += time.count();
+
+        }
+
+        // Not to be copied
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+    private:
+
+        // Members
+        ParStats *stats;
+        double ParStats::*phase;
+        std::chrono::steady_clock::time_point start;
+
+    };
+};
+
+// Source code, in the header-only configuration
+#ifdef READPARS_HEADER_ONLY
+#include "parstats.cpp"
+#endif
+
+#endif
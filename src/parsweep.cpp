@@ -0,0 +1,244 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParSweep class.
+
+#include "parsweep.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// Largest number of steps in a range (ranges are expanded lazily, but
+// their length must fit into an integer)
+static const double MAX_RANGE = 4294967296.0;
+
+// Error messages
+std::string ParSweep::errorInvalidSweep(const std::string &name, const size_t &line) const { return "Invalid sweep for parameter " + name + " in line " + std::to_string(line) + " of file " + filename; }
+std::string ParSweep::errorZipLength(const std::string &name, const size_t &line) const { return "Wrong number of zipped values for parameter " + name + " in line " + std::to_string(line) + " of file " + filename; }
+std::string ParSweep::errorDuplicateSweep(const std::string &name, const size_t &line) const { return "Duplicate sweep for parameter " + name + " in line " + std::to_string(line) + " of file " + filename; }
+std::string ParSweep::errorParseValue(const std::string &name, const size_t &line) const { return "Invalid value type for parameter " + name + " in line " + std::to_string(line) + " of file " + filename; }
+std::string ParSweep::errorTooManyPoints() const { return "Too many points in sweep of file " + filename; }
+std::string ParSweep::errorInvalidPoint(const size_t &k) const { return "Invalid point " + std::to_string(k) + " in sweep of file " + filename; }
+
+// Constructor
+ParSweep::ParSweep() :
+    filename(""),
+    base(ParSet()),
+    axes(std::vector<Axis>()),
+    npoints(1u)
+{}
+
+// Function to read a parameter file with sweeps
+void ParSweep::load(const std::string &filename) {
+
+    // filename: name of the file to read
+
+    // Remember the file
+    this->filename = filename;
+
+    // Prepare to read and store
+    ReadPars reader(filename);
+    ParBuilder builder(filename);
+
+    // Start afresh
+    axes.clear();
+
+    // Lines of zipped parameters (all in one dimension)
+    Axis zipped = { std::vector<Column>(), 0u };
+
+    // Open the file
+    reader.open();
+
+    // Remember that we are loading it (so included files cannot include
+    // it back)
+    const ParBuilder::Loading done(filename);
+
+    // For each line in the file...
+    while (!reader.iseof()) {
+
+        // Read a line
+        reader.readline();
+
+        // Skip empty and comment lines
+        if (reader.isempty() || reader.iscomment()) continue;
+
+        // Included files go into the fixed parameters (parsed only once)
+        if (reader.getname() == "include") {
+            builder.readline(reader);
+            continue;
+        }
+
+        // Read all the words on the line
+        std::vector<std::string> words;
+        reader.readall(words);
+
+        // Name and line number
+        const std::string name = reader.getname();
+        const size_t line = reader.getcount();
+
+        // Is the first word a keyword?
+        const bool keyword = !words.empty() && (words[0u] == "sweep" || words[0u] == "range" || words[0u] == "zip");
+
+        // Parse the numbers
+        std::vector<double> x;
+        for (size_t j = keyword ? 1u : 0u; j < words.size(); ++j) {
+
+            double y;
+            if (!ReadPars::parse(words[j], y)) throw std::runtime_error(errorParseValue(name, line));
+            x.push_back(y);
+
+        }
+
+        // Fixed parameters go into the base set
+        if (!keyword) {
+            builder.add(name, x, line);
+            continue;
+        }
+
+        // Each parameter can only be swept once
+        if (isswept(name, zipped) || std::any_of(axes.begin(), axes.end(), [&](const Axis &axis) { return isswept(name, axis); }))
+            throw std::runtime_error(errorDuplicateSweep(name, line));
+
+        // Prepare the swept parameter
+        Column column = { name, line, 0.0, 0.0, std::vector<double>() };
+
+        // Number of values it takes
+        size_t length = x.size();
+
+        // If it is a range...
+        if (words[0u] == "range") {
+
+            // Check
+            if (x.size() != 3u || !(x[2u] > 0.0) || x[1u] < x[0u])
+                throw std::runtime_error(errorInvalidSweep(name, line));
+
+            // Number of steps (both ends included, up to rounding)
+            const double steps = std::floor((x[1u] - x[0u]) / x[2u] + 1e-9);
+
+            // Check that it can be counted (this also rules out
+            // non-finite bounds and steps)
+            if (!(steps < MAX_RANGE))
+                throw std::runtime_error(errorInvalidSweep(name, line));
+
+            // Keep the bounds only
+            column.from = x[0u];
+            column.step = x[2u];
+            length = static_cast<size_t>(steps) + 1u;
+
+        } else {
+
+            // Otherwise keep the values
+            column.values = x;
+
+        }
+
+        // Check that there is something to sweep over
+        if (length == 0u) throw std::runtime_error(errorInvalidSweep(name, line));
+
+        // Zipped parameters must all have the same number of values
+        if (words[0u] == "zip") {
+
+            if (!zipped.columns.empty() && length != zipped.length)
+                throw std::runtime_error(errorZipLength(name, line));
+
+            zipped.columns.push_back(column);
+            zipped.length = length;
+            continue;
+
+        }
+
+        // Otherwise add a dimension
+        axes.push_back({ std::vector<Column>(1u, column), length });
+
+    }
+
+    // Close the file
+    reader.close();
+
+    // Zipped parameters come last
+    if (!zipped.columns.empty()) axes.push_back(zipped);
+
+    // Count the points, watching for overflow
+    npoints = 1u;
+    for (const Axis &axis : axes) {
+
+        if (npoints > std::numeric_limits<size_t>::max() / axis.length)
+            throw std::runtime_error(errorTooManyPoints());
+
+        npoints *= axis.length;
+
+    }
+
+    // Fixed parameters
+    base = builder.build();
+
+}
+
+// Function to get the value of a swept parameter at a given position
+double ParSweep::getvalue(const Column &column, const size_t &i) {
+
+    // column: swept parameter
+    // i: position along its dimension
+
+    // Ranges are computed on the fly
+    if (column.values.empty()) return column.from + static_cast<double>(i) * column.step;
+
+    return column.values[i];
+
+}
+
+// Function to tell if a parameter is swept along a dimension
+bool ParSweep::isswept(const std::string &name, const Axis &axis) {
+
+    // name: name of the parameter
+    // axis: dimension of the design
+
+    return std::any_of(axis.columns.begin(), axis.columns.end(), [&](const Column &column) { return column.name == name; });
+
+}
+
+// Function to get a single point of the design
+ParLayers ParSweep::getpoint(const size_t &k) const {
+
+    // k: index of the point (from zero to the number of points)
+
+    // Check
+    if (k >= npoints) throw std::runtime_error(errorInvalidPoint(k));
+
+    // Prepare to store the swept values
+    ParBuilder builder(filename);
+
+    // Remainder to decode
+    size_t r = k;
+
+    // For each dimension, the last one varying fastest...
+    for (size_t d = axes.size(); d > 0u; --d) {
+
+        // Dimension
+        const Axis &axis = axes[d - 1u];
+
+        // Position along it
+        const size_t i = r % axis.length;
+        r /= axis.length;
+
+        // Record each parameter of that dimension
+        for (const Column &column : axis.columns)
+            builder.add(column.name, std::vector<double>(1u, getvalue(column, i)), column.line);
+
+    }
+
+    // Stack the swept values on top of the fixed ones
+    ParLayers point(base);
+    point.addset(builder.build());
+
+    return point;
+
+}
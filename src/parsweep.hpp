@@ -0,0 +1,95 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARSWEEP_HPP
+#define READPARS_PARSWEEP_HPP
+
+// This header contains the ParSweep class, a parameter file in which some
+// parameters take several values, describing a whole design of runs.
+
+// Note: Three keywords can follow the name of a parameter:
+//
+//   mutrate sweep 0.001 0.01 0.1    (one value per point)
+//   popsize range 100 1000 100      (from, to and step, both ends included)
+//   seed zip 1 2 3                  (all zip lines advance together)
+//
+// Each sweep or range line is one dimension of the design, and all the zip
+// lines together make one more, coming last. The design is the Cartesian
+// product of its dimensions, with the last one varying fastest. Points are
+// never enumerated in advance: getpoint(k) decodes k dimension by dimension
+// and only builds the few values of that point, on top of the shared set
+// of fixed parameters. This way, each task of a job array can read the
+// same file and pick its own configuration.
+
+// Note: The file can include other files (see parset.hpp), which go into
+// the fixed parameters (they cannot have sweeps of their own). Sweeping
+// the same parameter twice is an error.
+
+#include "parlayers.hpp"
+
+class ParSweep {
+
+public:
+
+    // Constructor
+    ParSweep();
+
+    // Setters
+    void load(const std::string&);
+
+    // Getters
+    size_t size() const { return npoints; }
+    size_t getndims() const { return axes.size(); }
+    const ParSet& getbase() const { return base; }
+    ParLayers getpoint(const size_t&) const;
+
+private:
+
+    // Swept parameter
+    struct Column {
+
+        std::string name;
+        size_t line;
+        double from;
+        double step;
+        std::vector<double> values;
+
+    };
+
+    // Dimension of the design
+    struct Axis {
+
+        std::vector<Column> columns;
+        size_t length;
+
+    };
+
+    // Members
+    std::string filename;
+    ParSet base;
+    std::vector<Axis> axes;
+    size_t npoints;
+
+    // Private getters
+    static double getvalue(const Column&, const size_t&);
+    static bool isswept(const std::string&, const Axis&);
+
+    // Error messages
+    std::string errorInvalidSweep(const std::string&, const size_t&) const;
+    std::string errorZipLength(const std::string&, const size_t&) const;
+    std::string errorDuplicateSweep(const std::string&, const size_t&) const;
+    std::string errorParseValue(const std::string&, const size_t&) const;
+    std::string errorTooManyPoints() const;
+    std::string errorInvalidPoint(const size_t&) const;
+
+};
+
+#endif
@@ -0,0 +1,258 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParTable class.
+
+#include "partable.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <thread>
+#include <fstream>
+
+namespace {
+
+    // Location of a line in the file
+    struct Line {
+
+        size_t begin;
+        size_t end;
+        size_t number;
+
+    };
+
+    // Function to split a line into words (same rules as ReadPars)
+    std::vector<std::string_view> split(const std::string_view &line) {
+
+        // line: text of the line
+
+        // Prepare
+        std::vector<std::string_view> words;
+
+        // Take each word in turn
+        size_t cursor = 0u;
+        for (std::string_view word = ReadPars::nextword(line, cursor); !word.empty(); word = ReadPars::nextword(line, cursor))
+            words.push_back(word);
+
+        return words;
+
+    }
+}
+
+// Error messages
+std::string ParTable::errorParseValue(const std::string &name, const size_t &i) const { return "Invalid value type for parameter " + name + " in line " + std::to_string(lines[i]) + " of file " + filename; }
+std::string ParTable::errorCheck(const std::string &name, const std::string &error, const size_t &i) const { return "Parameter " + name + " " + error + " in line " + std::to_string(lines[i]) + " of file " + filename; }
+
+// Constructor
+ParTable::ParTable() :
+    filename(""),
+    names(std::vector<std::string>()),
+    lines(std::vector<size_t>()),
+    columns(std::vector<std::vector<double>>())
+{}
+
+// Function to read a table
+void ParTable::load(const std::string &filename, const size_t &nthreads) {
+
+    // filename: name of the file to read
+    // nthreads: number of threads to use (zero to use all the cores)
+
+    // Remember the file
+    this->filename = filename;
+
+    // Open the file
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) throw std::runtime_error("Unable to open file " + filename);
+
+    // Read it in one go
+    std::string content(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(content.data(), content.size());
+
+    // Check if the file is empty
+    if (content.empty()) throw std::runtime_error("File " + filename + " is empty");
+
+    // Start afresh
+    names.clear();
+    lines.clear();
+    columns.clear();
+
+    // Lines holding values
+    std::vector<Line> rows;
+
+    // Whether the header has been read
+    bool header = false;
+
+    // Line number
+    size_t count = 0u;
+
+    // For each line...
+    for (size_t start = 0u; start < content.size();) {
+
+        // End of the line
+        const char *newline = static_cast<const char*>(std::memchr(content.data() + start, '\n', content.size() - start));
+        const size_t end = newline ? newline - content.data() : content.size();
+
+        // Count it
+        ++count;
+
+        // Text of the line (without the carriage return of files with
+        // Windows line endings, as in ReadPars::readline)
+        const size_t begin = start;
+        std::string_view line(content.data() + begin, end - begin);
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1u);
+
+        // Move on
+        start = end + 1u;
+
+        // Skip empty and comment lines
+        if (line.empty() || line[0u] == '#') continue;
+
+        // The first line holds the names of the parameters
+        if (!header) {
+
+            // Location for error messages
+            const std::string location = " in line " + std::to_string(count) + " of file " + filename;
+
+            // Words on the line
+            const std::vector<std::string_view> words = split(line);
+
+            // There must be at least one
+            if (words.empty()) throw std::runtime_error("Could not read parameter name" + location);
+
+            // Read them
+            for (const std::string_view &word : words) {
+
+                // Check (a number is a row of values, not a name, so the
+                // header is missing)
+                double x;
+                if (!ReadPars::isvalid(word) || ReadPars::parse(word, x) || std::find(names.begin(), names.end(), word) != names.end())
+                    throw std::runtime_error("Invalid parameter: " + std::string(word) + location);
+
+                // Add it
+                names.push_back(std::string(word));
+
+            }
+
+            header = true;
+            continue;
+
+        }
+
+        // Other lines hold the values
+        rows.push_back({ begin, begin + line.size(), count });
+
+    }
+
+    // Check that there were names
+    if (!header) throw std::runtime_error("Missing parameter names in file " + filename);
+
+    // Make room for the values
+    lines.resize(rows.size());
+    columns.assign(names.size(), std::vector<double>(rows.size()));
+
+    // Number of threads
+    size_t n = nthreads ? nthreads : std::thread::hardware_concurrency();
+    n = std::max(size_t(1u), std::min(n, rows.size()));
+
+    // Errors encountered by each chunk of rows
+    std::vector<std::exception_ptr> errors(n);
+
+    // Work done on each chunk
+    auto work = [&](const size_t &t) {
+
+        // t: index of the chunk
+
+        // Rows of the chunk
+        const size_t first = rows.size() * t / n;
+        const size_t last = rows.size() * (t + 1u) / n;
+
+        // Stop at the first error, keeping it for later
+        try {
+
+            // For each row...
+            for (size_t i = first; i < last; ++i) {
+
+                // Line number
+                const std::string location = " in line " + std::to_string(rows[i].number) + " of file " + filename;
+
+                // Split into values
+                const std::vector<std::string_view> words = split(std::string_view(content.data() + rows[i].begin, rows[i].end - rows[i].begin));
+
+                // Check the number of values
+                if (words.size() > names.size()) throw std::runtime_error("Too many values" + location);
+                if (words.size() < names.size()) throw std::runtime_error("Too few values" + location);
+
+                // For each value...
+                for (size_t j = 0u; j < words.size(); ++j) {
+
+                    // Parse it
+                    double x;
+                    if (!ReadPars::isvalid(words[j]) || !ReadPars::parse(words[j], x))
+                        throw std::runtime_error("Invalid value type for parameter " + names[j] + location);
+
+                    // Store it
+                    columns[j][i] = x;
+
+                }
+
+                // Remember the line
+                lines[i] = rows[i].number;
+
+            }
+
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    // Launch the threads (the current thread takes the first chunk, and
+    // std::jthread joins those already launched if launching one fails)
+    std::vector<std::jthread> threads;
+    for (size_t t = 1u; t < n; ++t) threads.emplace_back(work, t);
+    work(0u);
+
+    // Wait for them
+    for (std::jthread &thread : threads) thread.join();
+
+    // Report the first error in file order
+    for (const std::exception_ptr &error : errors)
+        if (error) std::rethrow_exception(error);
+
+}
+
+// Function to find a column
+size_t ParTable::find(const std::string &name) const {
+
+    // name: name of the parameter
+
+    // Look for it
+    const auto it = std::find(names.begin(), names.end(), name);
+
+    return it == names.end() ? npos : static_cast<size_t>(it - names.begin());
+
+}
+
+// Function to view a whole column of values
+std::span<const double> ParTable::getcolumn(const std::string &name) const {
+
+    // name: name of the parameter
+
+    // Locate it
+    const size_t j = find(name);
+
+    // Check
+    if (j == npos) throw std::runtime_error("Missing parameter " + name + " in file " + filename);
+
+    return std::span<const double>(columns[j]);
+
+}
@@ -0,0 +1,117 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARTABLE_HPP
+#define READPARS_PARTABLE_HPP
+
+// This header contains the ParTable class, a table of parameters with one
+// column per parameter and one row per run, e.g.:
+//
+//   mutrate popsize seed
+//   0.01 100 1
+//   0.02 100 2
+//
+// Note: Values are stored column by column, each column being a single
+// contiguous vector, so a whole column can be checked or used at once.
+// Rows are split into chunks parsed on several threads, with the same
+// rules as in a regular parameter file (values separated by spaces, empty
+// and comment lines skipped). Error messages give line numbers in the file.
+// The first line that is not empty or a comment must hold the names, so a
+// table starting directly with values is reported as an error.
+
+#include "readpars.hpp"
+
+#include <limits>
+#include <span>
+
+class ParTable {
+
+public:
+
+    // Constructor
+    ParTable();
+
+    // Setters
+    void load(const std::string&, const size_t& = 0u);
+
+    // Getters
+    size_t size() const { return lines.size(); }
+    size_t getncols() const { return names.size(); }
+    std::string getname(const size_t &j) const { return names[j]; }
+    size_t getline(const size_t &i) const { return lines[i]; }
+    size_t find(const std::string&) const;
+    std::span<const double> getcolumn(const std::string&) const;
+
+    // Value returned when a column is not found
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    // Function to get a whole column of values
+    template <typename T>
+    void getcolumn(
+        const std::string &name,
+        std::vector<T> &values,
+        const std::function<std::string(const T&)> &check = nullptr,
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) const {
+
+        // name: name of the parameter
+        // values: vector to read into (one value per row)
+        // check: function used to check individual values
+        // checks: function used to check the whole column
+
+        // Stored values
+        const std::span<const double> x = getcolumn(name);
+
+        // Resize
+        values.resize(x.size());
+
+        // Convert all the values first, in one tight loop
+        size_t failed = npos;
+        for (size_t i = 0u; i < x.size(); ++i) {
+            T value = T();
+            if (!ReadPars::coerce(x[i], value) && failed == npos) failed = i;
+            values[i] = value;
+        }
+
+        // If error, throw
+        if (failed != npos) throw std::runtime_error(errorParseValue(name, failed));
+
+        // Check validity (value level)
+        if (check) {
+            for (size_t i = 0u; i < x.size(); ++i) {
+                const std::string error = check(values[i]);
+                if (!error.empty()) throw std::runtime_error(errorCheck(name, error, i));
+            }
+        }
+
+        // Check validity (column level)
+        const std::string error = checks ? checks(values) : "";
+
+        // If error, throw
+        if (!error.empty()) throw std::runtime_error("Parameter " + name + " " + error + " in file " + filename);
+
+    }
+
+private:
+
+    // Members
+    std::string filename;
+    std::vector<std::string> names;
+    std::vector<size_t> lines;
+    std::vector<std::vector<double>> columns;
+
+    // Error messages
+    std::string errorParseValue(const std::string&, const size_t&) const;
+    std::string errorCheck(const std::string&, const std::string&, const size_t&) const;
+
+};
+
+#endif
@@ -0,0 +1,216 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the ParTree class.
+
+#include "partree.hpp"
+
+#include <algorithm>
+
+// Function to find the child of a node with a given segment
+size_t ParTree::child(const std::vector<Node> &nodes, const size_t &i, const std::string_view &segment) {
+
+    // nodes: nodes of the tree
+    // i: index of the parent
+    // segment: part of the name to look for
+
+    // Children are kept in order, so search by halves
+    const std::vector<size_t> &children = nodes[i].children;
+    const auto it = std::lower_bound(children.begin(), children.end(), segment, [&](const size_t &j, const std::string_view &s) {
+        return nodes[j].segment < s;
+    });
+
+    return it != children.end() && nodes[*it].segment == segment ? *it : ParSet::npos;
+
+}
+
+// Constructor
+ParTree::ParTree(const ParSet &pars) :
+    data(nullptr),
+    root(0u),
+    prefix("")
+{
+
+    // pars: set of parameters to organize
+
+    // Prepare the content
+    auto content = std::make_shared<Data>();
+    content->pars = pars;
+
+    // Start with the root
+    std::vector<Node> &nodes = content->nodes;
+    nodes.push_back({ "", ParSet::npos, {} });
+
+    // For each parameter...
+    for (size_t i = 0u; i < pars.size(); ++i) {
+
+        // Name
+        const std::string name = pars.getname(i);
+
+        // Walk down the tree, one segment at a time
+        size_t node = 0u;
+        size_t start = 0u;
+        for (;;) {
+
+            // Next segment
+            size_t end = name.find('.', start);
+            if (end == std::string::npos) end = name.size();
+            const std::string segment = name.substr(start, end - start);
+
+            // Find the matching child, or add one in order
+            size_t next = child(nodes, node, segment);
+            if (next == ParSet::npos) {
+
+                next = nodes.size();
+                nodes.push_back({ segment, ParSet::npos, {} });
+
+                std::vector<size_t> &children = nodes[node].children;
+                const auto it = std::lower_bound(children.begin(), children.end(), segment, [&](const size_t &j, const std::string &s) {
+                    return nodes[j].segment < s;
+                });
+                children.insert(it, next);
+
+            }
+
+            // Move on
+            node = next;
+            if (end == name.size()) break;
+            start = end + 1u;
+
+        }
+
+        // The last node stands for the parameter (the last occurrence wins,
+        // as in ParSet::find)
+        nodes[node].index = i;
+
+    }
+
+    // Share it
+    data = content;
+
+}
+
+// Function to find the node of a name within the scope
+size_t ParTree::locate(const std::string &name) const {
+
+    // name: name within the scope (e.g. temp.mean)
+
+    // Walk down from the root of the scope
+    size_t node = root;
+    size_t start = 0u;
+    for (;;) {
+
+        // Next segment
+        size_t end = name.find('.', start);
+        if (end == std::string::npos) end = name.size();
+
+        // Find the matching child
+        node = child(data->nodes, node, std::string_view(name).substr(start, end - start));
+        if (node == ParSet::npos || end == name.size()) return node;
+
+        // Move on
+        start = end + 1u;
+
+    }
+}
+
+// Function to tell if a parameter exists within the scope
+bool ParTree::has(const std::string &name) const {
+
+    // name: name within the scope
+
+    const size_t node = locate(name);
+    return node != ParSet::npos && data->nodes[node].index != ParSet::npos;
+
+}
+
+// Function to find the index of a parameter within the scope or throw
+size_t ParTree::find(const std::string &name) const {
+
+    // name: name within the scope
+
+    // Walk down the tree
+    const size_t node = locate(name);
+
+    // Check
+    if (node == ParSet::npos || data->nodes[node].index == ParSet::npos)
+        throw std::runtime_error("Missing parameter " + prefix + name + " in file " + data->pars.getfilename());
+
+    return data->nodes[node].index;
+
+}
+
+// Function to get a view of a group of parameters
+ParTree ParTree::getscope(const std::string &name) const {
+
+    // name: name of the group within the scope (e.g. env or env.temp)
+
+    // Find it
+    const size_t node = locate(name);
+
+    // Check
+    if (node == ParSet::npos || data->nodes[node].children.empty())
+        throw std::runtime_error("Missing group " + prefix + name + " in file " + data->pars.getfilename());
+
+    // Same content, lower root
+    ParTree scope(*this);
+    scope.root = node;
+    scope.prefix = prefix + name + ".";
+
+    return scope;
+
+}
+
+// Function to list all the parameters within the scope
+std::vector<std::string> ParTree::getnames() const {
+
+    // Prepare
+    std::vector<std::string> names;
+
+    // Nodes to visit, with their names within the scope
+    std::vector<std::pair<size_t, std::string>> stack;
+    for (auto it = data->nodes[root].children.rbegin(); it != data->nodes[root].children.rend(); ++it)
+        stack.push_back({ *it, data->nodes[*it].segment });
+
+    // Depth-first, in order
+    while (!stack.empty()) {
+
+        // Next node
+        const auto [node, name] = stack.back();
+        stack.pop_back();
+
+        // Record it if it is a parameter
+        if (data->nodes[node].index != ParSet::npos) names.push_back(name);
+
+        // Visit its children next
+        const std::vector<size_t> &children = data->nodes[node].children;
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+            stack.push_back({ *it, name + "." + data->nodes[*it].segment });
+
+    }
+
+    return names;
+
+}
+
+// Function to list the groups right below the scope
+std::vector<std::string> ParTree::getgroups() const {
+
+    // Prepare
+    std::vector<std::string> groups;
+
+    // Children that have children of their own
+    for (const size_t &i : data->nodes[root].children)
+        if (!data->nodes[i].children.empty()) groups.push_back(data->nodes[i].segment);
+
+    return groups;
+
+}
@@ -0,0 +1,114 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_PARTREE_HPP
+#define READPARS_PARTREE_HPP
+
+// This header contains the ParTree class, a view of a parameter set whose
+// names are grouped by dots (e.g. pop.size, pop.growth, env.temp.mean).
+
+// Note: The names are split at the dots into a tree (a trie with one node
+// per group), built once. A scope (e.g. getscope("env")) is another view
+// of the same tree starting from a lower node, so each part of a program
+// can be handed only its own parameters, and read them by their short
+// names (e.g. temp.mean). Reading a value walks down the tree from the
+// scope, one segment at a time, to the node of the parameter, which knows
+// where it is in the set. Listing the parameters under a scope only walks
+// that part of the tree, without going through all the other names.
+
+#include "parset.hpp"
+
+class ParTree {
+
+public:
+
+    // Constructor
+    ParTree(const ParSet&);
+
+    // Getters
+    std::string getprefix() const { return prefix; }
+    bool has(const std::string&) const;
+    ParTree getscope(const std::string&) const;
+    std::vector<std::string> getnames() const;
+    std::vector<std::string> getgroups() const;
+    const ParSet& getset() const { return data->pars; }
+
+    // Function to get a single value
+    template <typename T>
+    void getvalue(
+        const std::string &name,
+        T &value,
+        const std::function<std::string(const T&)> &check = nullptr
+    ) const {
+
+        // name: name of the parameter within the scope
+        // value: variable to read into
+        // check: function used to check the value
+
+        data->pars.getvalue<T>(find(name), value, check);
+
+    }
+
+    // Function to get a vector of values
+    template <typename T>
+    void getvalues(
+        const std::string &name,
+        std::vector<T> &values,
+        const size_t &n,
+        const std::function<std::string(const T&)> &check = nullptr,
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) const {
+
+        // name: name of the parameter within the scope
+        // values: vector to read into
+        // n: number of values to read
+        // check: function used to check individual values
+        // checks: function used to check the vector of values
+
+        data->pars.getvalues<T>(find(name), values, n, check, checks);
+
+    }
+
+private:
+
+    // Group of names (or a single name, with the index of the parameter
+    // in the set, or ParSet::npos if the node is only a group)
+    struct Node {
+
+        std::string segment;
+        size_t index;
+        std::vector<size_t> children;
+
+    };
+
+    // Content shared by all the scopes
+    struct Data {
+
+        ParSet pars;
+        std::vector<Node> nodes;
+
+    };
+
+    // Members
+    std::shared_ptr<const Data> data;
+    size_t root;
+    std::string prefix;
+
+    // Private getters
+    size_t locate(const std::string&) const;
+    size_t find(const std::string&) const;
+
+    // Function to find the child of a node with a given segment
+    static size_t child(const std::vector<Node>&, const size_t&, const std::string_view&);
+
+};
+
+#endif
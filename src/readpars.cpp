@@ -13,15 +13,36 @@
 
 #include "readpars.hpp"
 
+#include <bit>
+#include <cerrno>
+#include <charconv>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#else
+#include <cstdio>
+#endif
+
 // Constructor
-ReadPars::ReadPars(const std::string &filename) : 
+READPARS_INLINE ReadPars::ReadPars(const std::string &filename) : 
     filename(filename),
-    file(std::ifstream()),
+    buffer(""),
+    pos(0u),
+    reading(false),
     count(0u),
     empty(false),
     comment(false),
-    line(std::istringstream()),
-    name("")
+    line(),
+    cursor(0u),
+    name(),
+    schema(nullptr),
+    id(ParSchema::npos),
+    seen(std::vector<uint64_t>()),
+    stats(nullptr),
+    profile(nullptr),
+    entry(nullptr)
 {
 
     // filename: name of the file to read
@@ -29,53 +50,149 @@ ReadPars::ReadPars(const std::string &filename) :
 }
 
 // Error messages
-std::string ReadPars::errorOpenFile() const { return "Unable to open file " + filename; }
-std::string ReadPars::errorEmptyFile() const { return "File " + filename + " is empty"; }
-std::string ReadPars::errorReadName() const { return "Could not read parameter name in line " + std::to_string(count) + " of file " + filename; }
-std::string ReadPars::errorNoValue() const { return "No value for parameter " + name + " in line " + std::to_string(count) + " of file " + filename; }
-std::string ReadPars::errorReadValue() const { return "Could not read value for parameter " + name + " in line " + std::to_string(count) + " of file " + filename; }
-std::string ReadPars::errorParseValue() const { return "Invalid value type for parameter " + name + " in line " + std::to_string(count) + " of file " + filename; }
-std::string ReadPars::errorTooManyValues() const { return "Too many values for parameter " + name + " in line " + std::to_string(count) + " of file " + filename; }
-std::string ReadPars::errorTooFewValues() const { return "Too few values for parameter " + name + " in line " + std::to_string(count) + " of file " + filename; }
-std::string ReadPars::errorInvalidParameter() const { return "Invalid parameter: " + name + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorOpenFile() const { return "Unable to open file " + filename; }
+READPARS_INLINE std::string ReadPars::errorEmptyFile() const { return "File " + filename + " is empty"; }
+READPARS_INLINE std::string ReadPars::errorReadName() const { return "Could not read parameter name in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorNoValue() const { return "No value for parameter " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorReadValue() const { return "Could not read value for parameter " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorParseValue() const { return "Invalid value type for parameter " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorTooManyValues() const { return "Too many values for parameter " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorTooFewValues() const { return "Too few values for parameter " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorDuplicate() const { return "Duplicate parameter " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
+READPARS_INLINE std::string ReadPars::errorMissing(const size_t &i) const { return "Missing parameter " + schema->getname(i) + " in file " + filename; }
+READPARS_INLINE std::string ReadPars::errorInvalidParameter() const { return "Invalid parameter: " + std::string(name) + " in line " + std::to_string(count) + " of file " + filename; }
 
 // Function to error on invalid parameter
-void ReadPars::readerror() const {
+READPARS_INLINE void ReadPars::readerror() const {
 
     // Throw error
-    throw std::runtime_error(errorInvalidParameter());
+    fail(&ReadPars::errorInvalidParameter);
 
 }
 
 // Function to format error message
-void ReadPars::checkerror(const std::string &error) const {
+READPARS_INLINE void ReadPars::checkerror(const std::string &error) const {
 
     // error: error message to format
 
     // Check if error is empty
     if (error.empty()) return;
 
-    // Or format the error message
-    std::string message = "Parameter " + name + " " + error + " in line " + std::to_string(count) + " of file " + filename;
+    // Or format the error message (timed)
+    std::string message;
+    {
+        ParStats::Timer timer(stats, &ParStats::error);
+        message = "Parameter " + std::string(name) + " " + error + " in line " + std::to_string(count) + " of file " + filename;
+    }
+
+    // Count it
+    if (stats) ++stats->errors;
 
     // And throw exception
     throw std::runtime_error(message);
 
 }
 
-// Function to open the file
-void ReadPars::open() {
+// Function to throw an error
+READPARS_INLINE void ReadPars::fail(std::string (ReadPars::*message)() const) const {
+
+    // message: function making the error message
+
+    // Make the message (timed)
+    std::string text;
+    {
+        ParStats::Timer timer(stats, &ParStats::error);
+        text = (this->*message)();
+    }
+
+    // Count it
+    if (stats) ++stats->errors;
+
+    // And throw exception
+    throw std::runtime_error(text);
+
+}
+
+// Function to read the whole file into the buffer
+READPARS_INLINE bool ReadPars::load() {
+
+    // Note: Returns false if the file could not be opened or read.
+
+    // Read the whole file in one go
+    buffer.clear();
+
+#ifndef _WIN32
 
     // Open the file
-    file.open(filename.c_str());
+    const int fd = ::open(filename.c_str(), O_RDONLY);
 
     // Check if the file is open
-    if (!isopen())
-        throw std::runtime_error(errorOpenFile());
+    if (fd < 0) return false;
+
+    // Make room for the content (the size is only a hint)
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) buffer.reserve(static_cast<size_t>(info.st_size));
+
+    // Read it in chunks until the end
+    char chunk[65536];
+    for (;;) {
+        const ssize_t n = ::read(fd, chunk, sizeof chunk);
+        if (n > 0) { buffer.append(chunk, static_cast<size_t>(n)); continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) { ::close(fd); return false; }
+        break;
+    }
+
+    // Done with the file
+    ::close(fd);
+
+#else
+
+    // Note: Without file descriptors the C library is used instead.
+
+    // Open the file
+    std::FILE *fp = std::fopen(filename.c_str(), "rb");
+
+    // Check if the file is open
+    if (!fp) return false;
+
+    // Read it in chunks until the end
+    char chunk[65536];
+    for (size_t n; (n = std::fread(chunk, 1u, sizeof chunk, fp)) > 0u;) buffer.append(chunk, n);
+
+    // Done with the file
+    std::fclose(fp);
+
+#endif
+
+    return true;
+
+}
+
+// Function to open the file
+READPARS_INLINE void ReadPars::open() {
+
+    // Read the file (timed)
+    bool ok;
+    {
+        ParStats::Timer timer(stats, &ParStats::io);
+        ok = load();
+    }
+
+    // Check
+    if (!ok)
+        fail(&ReadPars::errorOpenFile);
+
+    // Count what was read
+    if (stats) stats->bytes += buffer.size();
+
+    // Read from the start
+    pos = 0u;
+    reading = true;
 
     // Check if the file is empty
     if (iseof())
-        throw std::runtime_error(errorEmptyFile());
+        fail(&ReadPars::errorEmptyFile);
 
     // Check
     assert(isopen());
@@ -84,53 +201,138 @@ void ReadPars::open() {
 
 }
 
+// Function to read text already in memory instead of the file
+READPARS_INLINE void ReadPars::open(const std::string_view &content, const size_t &offset) {
+
+    // content: text to read, laid out like a parameter file
+    // offset: number of lines preceding the text in the file
+
+    // Note: This is useful when a file holds several pieces to be parsed
+    // separately (e.g. one document per run). The name of the file and
+    // the offset are only used to point error messages to the right place.
+
+    // Copy the text (timed, as the equivalent of reading the file)
+    {
+        ParStats::Timer timer(stats, &ParStats::io);
+        buffer.assign(content);
+    }
+
+    // Count what was read
+    if (stats) stats->bytes += buffer.size();
+
+    // Read from the start
+    pos = 0u;
+    reading = true;
+
+    // Check if the text is empty
+    if (iseof())
+        fail(&ReadPars::errorEmptyFile);
+
+    // Start counting lines from there
+    count = offset;
+
+    // Check
+    assert(isopen());
+    assert(!iseof());
+
+}
+
 // Function to reset a line
-void ReadPars::reset() {
+READPARS_INLINE void ReadPars::reset() {
 
     // Reset
     empty = false;
     comment = false;
-    line.clear();
-    line.str("");
-    line.seekg(0, std::ios::beg);
-    name.clear();
+    line = std::string_view();
+    cursor = 0u;
+    name = std::string_view();
+    id = ParSchema::npos;
+    entry = nullptr;
 
 }
 
 // Function to make sure the next thing can be read
-bool ReadPars::readnext(std::istringstream &line, std::string &input) {
+READPARS_INLINE bool ReadPars::readnext(std::string_view &input) {
+
+    // input: view to read into
+
+    // Split the word off (timed)
+    {
+        ParStats::Timer timer(stats, &ParStats::split);
+        input = nextword(line, cursor);
+    }
+
+    // Count it
+    if (stats) ++stats->tokens;
+
+    // Check if error (timed)
+    ParStats::Timer timer(stats, &ParStats::validate);
+    bool error = input.empty() || !isvalid(input);
+
+    // Return error code
+    return !error;
 
-    // line: line to read from
-    // input: string to read into
+}
 
-    // Read the parameter name
-    line >> input;
+// Function to parse a piece of text into a number
+READPARS_INLINE bool ReadPars::parse(const std::string_view &input, double &x) {
 
-    // Check if error
-    bool error = line.fail();
+    // input: text to parse (a single word)
+    // x: number to parse into
 
-    // If not...
-    if (!error) {
+    // Bounds of the text
+    const char *first = input.data();
+    const char *last = first + input.size();
 
-        // For each character...
-        for (char c : input) {
+    // Read the value and make sure nothing is left
+    const std::from_chars_result result = std::from_chars(first, last, x);
+    if (result.ptr != last) return false;
 
-            // Make sure it is alphanumeric or a dot or a minus
-            if (!std::isalnum(c) && c != '.' && c != '-') error = true;
+    // Note: Unlike streams, std::from_chars accepts infinity and not-a-number,
+    // which are not valid values, and rejects numbers too small to be told
+    // apart from zero, which are read as zero.
 
-            // Exit if needed
-            if (error) break;
+    // Success, as long as the number is finite
+    if (result.ec == std::errc()) return std::isfinite(x);
 
-        }
+    // Otherwise find out whether the number was too large or too small
+    if (result.ec != std::errc::result_out_of_range) return false;
+
+    // Order of magnitude of the digits (position of the first non-zero one
+    // relative to the decimal point)
+    long magnitude = 0;
+    const char *p = first + (*first == '-');
+    bool dot = false, nonzero = false;
+    for (; p != last && *p != 'e' && *p != 'E'; ++p) {
+        if (*p == '.') { dot = true; continue; }
+        if (*p != '0') nonzero = true;
+        if (!nonzero && dot) --magnitude;
+        if (nonzero && !dot) ++magnitude;
     }
 
-    // Return error code
-    return !error;
+    // Exponent, if any
+    long exponent = 0;
+    if (p != last) {
+        const char *q = p + 1 + (p[1] == '-' || p[1] == '+');
+        for (; q != last && exponent < 100000; ++q) exponent = 10 * exponent + (*q - '0');
+        if (p[1] == '-') exponent = -exponent;
+    }
+
+    // Too large numbers are errors
+    if (magnitude + exponent > 0) return false;
+
+    // Too small ones are zero
+    x = *first == '-' ? -0.0 : 0.0;
+
+    return true;
 
 }
 
 // Function to read a line from the file
-void ReadPars::readline() {
+READPARS_INLINE size_t ReadPars::readline() {
+
+    // Note: Returns the id of the parameter in the schema, if any, or
+    // ParSchema::npos for unknown parameters, empty and comment lines.
 
     // Check
     assert(isopen());
@@ -139,41 +341,171 @@ void ReadPars::readline() {
     // Reset
     reset();
 
-    // Temporary container
-    std::string temp;
+    // Split the line off (timed)
+    {
+        ParStats::Timer timer(stats, &ParStats::split);
 
-    // Read the line
-    std::getline(file, temp);
+        // Find the end of the line
+        size_t end = buffer.find('\n', pos);
+        if (end == std::string::npos) end = buffer.size();
+
+        // Take the line
+        line = std::string_view(buffer).substr(pos, end - pos);
+
+        // Move on to the next one
+        pos = end + 1u;
+
+        // Drop the carriage return of files with Windows line endings
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1u);
+
+    }
+
+    // Count it
+    if (stats) ++stats->lines;
 
     // Check if the line is empty
-    empty = temp.empty();
+    empty = line.empty();
 
     // Check if the line is a comment
-    comment = temp[0] == '#';
-
-    // Convert the line into a stream
-    line.str(temp);
+    comment = !empty && line[0] == '#';
 
     // Increment line count
     ++count;
 
     // If needed...
-    if (empty || comment) return;
+    if (empty || comment) return id;
 
     // Error if needed
-    if (!readnext(line, name))
-        throw std::runtime_error(errorReadName());
+    if (!readnext(name))
+        fail(&ReadPars::errorReadName);
+
+    // Find the parameter in the profile (if any)
+    if (profile) {
+        entry = &profile->getentry(name);
+        ++entry->lines;
+    }
 
     // Check that we are not at the end of the line
     if (iseol())
-        throw std::runtime_error(errorNoValue());
+        fail(&ReadPars::errorNoValue);
+
+    // If there is no schema, we are done
+    if (!schema) return id;
+
+    // Identify the parameter
+    id = schema->find(name);
+
+    // Note: Unknown parameters are left to the user (e.g. to call readerror()).
+    if (id == ParSchema::npos) return id;
+
+    // Check that it has not been seen before
+    if (isseen(id))
+        fail(&ReadPars::errorDuplicate);
+
+    // Mark it as seen
+    seen[id / 64u] |= uint64_t(1u) << (id % 64u);
+
+    return id;
+
+}
+
+// Function to give the reader a list of expected parameters
+READPARS_INLINE void ReadPars::setschema(const ParSchema &value) {
+
+    // value: expected parameters (must outlive the reader and be complete)
+
+    // Remember it
+    schema = &value;
+
+    // Nothing seen yet
+    seen.assign(schema->getrequired().size(), 0u);
+
+}
+
+// Function to give the reader statistics to record into
+READPARS_INLINE void ReadPars::setstats(ParStats &value) {
+
+    // value: statistics to add to (must outlive the reader)
+
+    // Remember them
+    stats = &value;
+
+}
+
+// Function to give the reader a profile to record into
+READPARS_INLINE void ReadPars::setprofile(ParProfile &value) {
+
+    // value: profile to add to (must outlive the reader)
+
+    // Remember it
+    profile = &value;
+
+}
+
+// Function to check that all required parameters have been seen
+READPARS_INLINE void ReadPars::checkmissing() const {
+
+    // Check
+    assert(schema);
+
+    // Required parameters
+    const std::vector<uint64_t> &required = schema->getrequired();
+
+    // For each word of bits...
+    for (size_t w = 0u; w < seen.size(); ++w) {
+
+        // Required but not seen
+        const uint64_t missing = required[w] & ~seen[w];
+
+        // Report the first one
+        if (!missing) continue;
+        std::string message;
+        {
+            ParStats::Timer timer(stats, &ParStats::error);
+            message = errorMissing(w * 64u + std::countr_zero(missing));
+        }
+        if (stats) ++stats->errors;
+        throw std::runtime_error(message);
+
+    }
+}
+
+// Function to list the parameters left to their defaults
+READPARS_INLINE std::vector<size_t> ReadPars::getdefaulted() const {
+
+    // Check
+    assert(schema);
+
+    // Prepare
+    std::vector<size_t> ids;
+
+    // Required parameters
+    const std::vector<uint64_t> &required = schema->getrequired();
+
+    // For each word of bits...
+    for (size_t w = 0u; w < seen.size(); ++w) {
+
+        // Neither required nor seen (the last word may have unused bits)
+        uint64_t left = ~required[w] & ~seen[w];
+        if (w + 1u == seen.size() && schema->size() % 64u)
+            left &= (uint64_t(1u) << (schema->size() % 64u)) - 1u;
+
+        // For each of them, lowest first...
+        for (; left; left &= left - 1u) ids.push_back(w * 64u + std::countr_zero(left));
+
+    }
+
+    return ids;
 
 }
 
 // Function to close the input file
-void ReadPars::close() {
+READPARS_INLINE void ReadPars::close() {
+
+    // Note: The file itself was closed as soon as it was read, and the
+    // content is kept until the reader is reopened or destroyed.
 
-    // Close
-    file.close();
+    // Stop reading
+    reading = false;
 
 }
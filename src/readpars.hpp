@@ -17,13 +17,35 @@
 // Note: Some functions in this header could be made in such a way
 // that they can be called from other scripts, e.g. from a name space.
 
+// Note: The reader does not use streams. The file is read in one go with
+// a system call into a single buffer, lines and words are views into that
+// buffer, and numbers are converted with std::from_chars. This keeps the
+// reader small, and programs that only read parameters free of the static
+// initialization and locale machinery of the iostream library.
+
+// Note: Defining READPARS_HEADER_ONLY (for the whole project, or before
+// including this header) brings the source code of the core (this class
+// and ParSchema) into the headers as inline functions. There is then no
+// source file to compile, and the functions reading lines and words can
+// be inlined into the loops calling them without link-time optimization.
+
+// Note: Statistics on where the time of the reader goes can be recorded
+// with setstats() (see parstats.hpp), and the time taken by each parameter
+// with setprofile() (see parprofile.hpp).
+
+#include "parschema.hpp"
+#include "parstats.hpp"
+#include "parprofile.hpp"
+
 #include <string>
-#include <sstream>
-#include <fstream>
+#include <string_view>
 #include <vector>
 #include <cassert>
+#include <stdexcept>
 #include <functional>
 #include <cmath>
+#include <charconv>
+#include <limits>
 
 class ReadPars {
 
@@ -34,22 +56,33 @@ public:
 
     // Setters
     void open();
-    void readline();
+    void open(const std::string_view&, const size_t& = 0u);
+    size_t readline();
     void close();
+    void setschema(const ParSchema&);
+    void setstats(ParStats&);
+    void setprofile(ParProfile&);
 
     // Breaker
     void readerror() const;
+
+    // Final checks against the schema
+    void checkmissing() const;
+    std::vector<size_t> getdefaulted() const;
     
     // Getters
-    bool isopen() const { return file.is_open(); }
-    bool iseof() { return file.peek() == std::ifstream::traits_type::eof(); }
-    bool iseol() { return line.peek() == std::istringstream::traits_type::eof(); }
+    bool isopen() const { return reading; }
+    bool iseof() const { return pos >= buffer.size(); }
+    bool iseol() const { return cursor == line.size(); }
     bool isempty() const { return empty; }
     bool iscomment() const { return comment; }
     size_t getcount() const { return count; }
     std::string getfilename() const { return filename; }
-    std::string getline() const { return line.str(); }
-    std::string getname() const { return name; }
+    std::string getline() const { return std::string(line); }
+    std::string getname() const { return std::string(name); }
+    std::string getrest() const { return std::string(line.substr(cursor)); }
+    size_t getid() const { return id; }
+    bool isseen(const size_t &i) const { return (seen[i / 64u] >> (i % 64u)) & 1u; }
 
     // Function to read a single value
     template <typename T> 
@@ -66,7 +99,7 @@ public:
     
         // Check that we have reached the end of the line
         if (!iseol())
-            throw std::runtime_error(errorTooManyValues());
+            fail(&ReadPars::errorTooManyValues);
         
     }
 
@@ -99,7 +132,7 @@ public:
     
             // If too many values...
             if (i == n) 
-                throw std::runtime_error(errorTooManyValues());
+                fail(&ReadPars::errorTooManyValues);
             
             // Prepare to store the value
             T value;
@@ -117,38 +150,217 @@ public:
     
         // If too few values...
         if (i != n) 
-            throw std::runtime_error(errorTooFewValues());
+            fail(&ReadPars::errorTooFewValues);
         
         // Check
         assert(i == n);
         assert(values.size() == n);
 
         // Check validity (vector level)
-        std::string error = checks ? checks(values) : "";
+        std::string error;
+        if (checks) {
+            ParStats::Timer timer(stats, &ParStats::check);
+            ParProfile::Timer ptimer(entry, &ParProfile::Entry::check);
+            error = checks(values);
+        }
+
+        // If error, throw
+        checkerror(error);
+    
+    }
+
+    // Function to tell if a character separates words
+    static constexpr bool isspace(const char &c) { return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f' || c == '\n'; }
+
+    // Function to tell if a character is allowed in names and values
+    static constexpr bool isallowed(const char &c) {
+
+        // Alphanumeric, a dot or a minus
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '-';
+
+    }
+
+    // Function to check that a piece of text only contains allowed characters
+    static constexpr bool isvalid(const std::string_view &input) {
+
+        // input: text to check
+
+        // For each character...
+        for (const char &c : input)
+            if (!isallowed(c)) return false;
+
+        return true;
+
+    }
+
+    // Function to split the next word off a line
+    static constexpr std::string_view nextword(const std::string_view &line, size_t &cursor) {
+
+        // line: line to split
+        // cursor: position to start from, moved to the end of the word
+
+        // Note: Words are separated by white space, as they would be when
+        // read from a stream. The word is empty if there is none left.
+
+        // Skip leading spaces
+        while (cursor < line.size() && isspace(line[cursor])) ++cursor;
+
+        // Find the end of the word
+        const size_t start = cursor;
+        while (cursor < line.size() && !isspace(line[cursor])) ++cursor;
+
+        // Take it
+        return line.substr(start, cursor - start);
+
+    }
+
+    // Function to parse a piece of text into a number
+    static bool parse(const std::string_view&, double&);
+
+    // Function to read all the remaining values on the line
+    template <typename T> 
+    void readall(
+        std::vector<T> &values, 
+        const std::function<std::string(const T&)> &check = nullptr, 
+        const std::function<std::string(const std::vector<T>&)> &checks = nullptr
+    ) {
+
+        // values: vector to read into
+        // check: function used to check individual values
+        // checks: function used to check the vector of values
+
+        // Note: This is useful when the number of values is not known in
+        // advance, e.g. when a whole file is parsed into a parameter set.
+
+        // Reset
+        values.clear();
+    
+        // While we have not reached the end of the line...
+        while (!iseol()) {
+            
+            // Prepare to store the value
+            T value;
+    
+            // Read the value
+            read(value, check);
+    
+            // Add to the vector
+            values.push_back(value);
+    
+        }
+
+        // Check validity (vector level)
+        std::string error;
+        if (checks) {
+            ParStats::Timer timer(stats, &ParStats::check);
+            ParProfile::Timer ptimer(entry, &ParProfile::Entry::check);
+            error = checks(values);
+        }
 
         // If error, throw
         checkerror(error);
     
     }
 
+    // Function to parse a whole number exactly into an integer type
+    template <typename T>
+    static bool parseint(const std::string_view &input, T &value) {
+
+        // input: text to parse (a single word)
+        // value: variable to parse into
+
+        // Note: Doubles only hold integers up to 2^53 exactly, so integers
+        // written in full (e.g. by WritePars) are read without going
+        // through a double. Anything else (e.g. 1e3) returns false, and is
+        // then parsed as a number and coerced.
+
+        // Booleans and floating point numbers are not concerned
+        if constexpr (!std::is_integral_v<T> || std::is_same_v<T, bool>) return false;
+        else {
+
+            // Parse (the whole word, within range)
+            const char *last = input.data() + input.size();
+            const std::from_chars_result result = std::from_chars(input.data(), last, value);
+            return result.ec == std::errc() && result.ptr == last;
+
+        }
+    }
+
+    // Function to coerce a parsed number into the requested type
+    template <typename T>
+    static constexpr bool coerce(const double &x, T &value) {
+
+        // x: number to coerce
+        // value: variable to coerce into
+
+        // Special check for integers (including unsigned ones and booleans),
+        // which must be within range of the requested type...
+        if constexpr (std::is_integral_v<T>) {
+            const double upper = 2.0 * static_cast<double>(std::numeric_limits<T>::max() / 2 + 1);
+            if (!(x >= static_cast<double>(std::numeric_limits<T>::min()) && x < upper))
+                return false;
+        }
+
+        // Note: Converting a number out of range of an integer type is undefined behavior.
+        // The upper bound is a power of two, so it is exact as a double, unlike the largest
+        // integer itself (e.g. INT64_MAX, which rounds up to 2^63). The range also rules out
+        // non-finite numbers, negative numbers for unsigned integers (which would otherwise
+        // become very large numbers), and numbers above one for booleans.
+
+        // ... and whole numbers
+        if constexpr (std::is_integral_v<T>)
+            if (static_cast<double>(static_cast<T>(x)) != x)
+                return false;
+
+        // Note: This is written without calls that cannot run at compile time (e.g.
+        // std::floor), so it is shared with ConstPars.
+
+        // Final value
+        value = static_cast<T>(x);
+
+        // Success
+        return true;
+
+    }
+
 private:
 
     // File members
     std::string filename;
-    std::ifstream file;
-    
+
+    // Content being read (the whole file, or text given in memory) and
+    // position of the next line in it
+    std::string buffer;
+    size_t pos;
+    bool reading;
+
     // Line counter
     size_t count;
 
-    // Line members
+    // Line members (views into the content, with the position of the next
+    // word on the line)
     bool empty;
     bool comment;
-    std::istringstream line;
-    std::string name;
+    std::string_view line;
+    size_t cursor;
+    std::string_view name;
+
+    // Expected parameters (if any), id of the current one and those seen
+    const ParSchema *schema;
+    size_t id;
+    std::vector<uint64_t> seen;
+
+    // Statistics to record into (if any)
+    ParStats *stats;
+
+    // Profile to record into (if any) and entry of the current parameter
+    ParProfile *profile;
+    ParProfile::Entry *entry;
 
     // Private setters
     void reset();
-    bool readnext(std::istringstream&, std::string&);
+    bool load();
+    bool readnext(std::string_view&);
 
     // Error messages
     std::string errorOpenFile() const;
@@ -160,10 +372,15 @@ private:
     std::string errorTooManyValues() const;
     std::string errorTooFewValues() const;
     std::string errorInvalidParameter() const;
+    std::string errorDuplicate() const;
+    std::string errorMissing(const size_t&) const;
 
     // Validity errors
     void checkerror(const std::string&) const;
 
+    // Function to throw an error
+    [[noreturn]] void fail(std::string (ReadPars::*)() const) const;
+
     // // Function to read a value from the current line
     template <typename T> 
     void read(
@@ -175,57 +392,57 @@ private:
         // check: function used to check the value
 
         // Temporary receptacle
-        std::string temp;
+        std::string_view temp;
 
         // Make sure the next value can be read
-        if (!readnext(line, temp)) 
-            throw std::runtime_error(errorReadValue());
+        if (!readnext(temp)) 
+            fail(&ReadPars::errorReadValue);
             
-        // Prepare to store the value
-        std::istringstream stream(temp);
+        // Strings are taken as they are
+        if constexpr (std::is_same_v<T, std::string>) {
 
-        // Prepare receptacle for the value
-        double x;
+            value = std::string(temp);
 
-        // Prepare to capture leftover characters 
-        char leftover;
+        } else {
 
-        // Read the value and check
-        if (!(stream >> x) || (stream >> leftover))
-            throw std::runtime_error(errorParseValue());
+            // Prepare receptacle for the value
+            double x;
+            bool ok;
 
-        // Special check for integers
-        if (std::is_integral_v<T>)
-            if (!std::isfinite(x) || std::floor(x) != x)
-                throw std::runtime_error(errorParseValue());
+            // Read the value and coerce it into the requested type (timed)
+            {
+                ParStats::Timer timer(stats, &ParStats::convert);
+                ParProfile::Timer ptimer(entry, &ParProfile::Entry::convert);
+                ok = parseint(temp, value) || (parse(temp, x) && coerce(x, value));
+            }
 
-        // Special check for unsigned integers
-        if (std::is_unsigned_v<T>)
-            if (x < 0.0)
-                throw std::runtime_error(errorParseValue());
+            // Check
+            if (!ok)
+                fail(&ReadPars::errorParseValue);
 
-        // Note: Negative numbers can be read without problem into an unsigned integer, but
-        // will be converted to very large numbers. To catch that issue, we first read into
-        // double, check that the number is positive, and then convert into unsigned.
+        }
 
-        // Special check for booleans
-        if (std::is_same_v<T, bool>)
-            if (x > 1.0)
-                throw std::runtime_error(errorParseValue());
+        // Count it
+        if (stats) {
+            if constexpr (std::is_same_v<T, std::string>) ++stats->strings;
+            else if constexpr (std::is_same_v<T, bool>) ++stats->booleans;
+            else if constexpr (std::is_integral_v<T>) ++stats->integers;
+            else ++stats->reals;
+        }
+        if (entry) ++entry->values;
 
-        // Note: Similarly, coercing into a boolean does not return an error when the input
-        // is a positive number above one. Hence the extra check. Note that the above checks
-        // for integers will also have been run for the boolean case.
+        // Note: Strings follow the same rules as the other values, i.e. they
+        // may only contain alphanumeric characters, dots and minus signs.
 
-        // Final value
-        value = static_cast<T>(x);
-
-        // TODO: Make it work for strings too
-        // TODO: Make it work for vectors of strings
         // TODO: Character type?
 
         // Check validity
-        std::string error = check ? check(value) : "";
+        std::string error;
+        if (check) {
+            ParStats::Timer timer(stats, &ParStats::check);
+            ParProfile::Timer ptimer(entry, &ParProfile::Entry::check);
+            error = check(value);
+        }
 
         // If error, throw
         checkerror(error);
@@ -233,4 +450,9 @@ private:
     }
 };
 
+// Source code, in the header-only configuration
+#ifdef READPARS_HEADER_ONLY
+#include "readpars.cpp"
+#endif
+
 #endif
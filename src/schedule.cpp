@@ -0,0 +1,170 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the Schedule class.
+
+#include "schedule.hpp"
+
+#include <algorithm>
+
+// Longest span of time steps stored in a table
+static const size_t MAX_TABLE = 1u << 20u;
+
+// Constructor
+Schedule::Schedule() :
+    mode(Linear),
+    start(0u),
+    end(0u),
+    table(std::vector<double>(1u, 0.0)),
+    times(std::vector<size_t>()),
+    values(std::vector<double>())
+{}
+
+// Function to read a schedule from the current line of a reader
+void Schedule::read(ReadPars &reader) {
+
+    // reader: reader whose current line holds the schedule
+
+    // Error message
+    const std::string error = "Invalid schedule for parameter " + reader.getname() + " in line " + std::to_string(reader.getcount()) + " of file " + reader.getfilename();
+
+    // Words after the name of the parameter (split like any other line,
+    // but not checked, as breakpoints contain colons)
+    const std::string line = reader.getline();
+    size_t cursor = 0u;
+    ReadPars::nextword(line, cursor);
+
+    // The line must be a schedule
+    if (ReadPars::nextword(line, cursor) != "schedule") throw std::runtime_error(error);
+
+    // Prepare to store the breakpoints
+    std::vector<size_t> times;
+    std::vector<double> values;
+
+    // Mode
+    Mode m = Linear;
+
+    // For each word...
+    for (std::string_view word = ReadPars::nextword(line, cursor); !word.empty(); word = ReadPars::nextword(line, cursor)) {
+
+        // Optional mode first
+        if (times.empty() && (word == "step" || word == "linear")) {
+            m = word == "step" ? Step : Linear;
+            continue;
+        }
+
+        // Split time and value
+        const size_t colon = word.find(':');
+        if (colon == std::string_view::npos) throw std::runtime_error(error);
+
+        // Parse them
+        const std::string_view t = word.substr(0u, colon);
+        const std::string_view x = word.substr(colon + 1u);
+        double time, value;
+        if (!ReadPars::isvalid(t) || !ReadPars::parse(t, time)) throw std::runtime_error(error);
+        if (!ReadPars::isvalid(x) || !ReadPars::parse(x, value)) throw std::runtime_error(error);
+
+        // Times must be natural numbers
+        size_t u;
+        if (!ReadPars::coerce(time, u)) throw std::runtime_error(error);
+
+        // Store
+        times.push_back(u);
+        values.push_back(value);
+
+    }
+
+    // Check the breakpoints
+    if (times.empty()) throw std::runtime_error(error);
+    for (size_t i = 1u; i < times.size(); ++i)
+        if (times[i] <= times[i - 1u]) throw std::runtime_error(error);
+    for (const double &x : values)
+        if (!std::isfinite(x)) throw std::runtime_error(error);
+
+    // Build the table
+    set(times, values, m);
+
+}
+
+// Function to build the table from breakpoints
+void Schedule::set(const std::vector<size_t> &t, const std::vector<double> &x, const Mode &m) {
+
+    // t: times of the breakpoints (strictly increasing)
+    // x: values at the breakpoints
+    // m: way of filling the gaps between breakpoints
+
+    // Check
+    assert(!t.empty());
+    assert(t.size() == x.size());
+
+    // Remember the mode, first and last times
+    mode = m;
+    start = t.front();
+    end = t.back();
+
+    // Long schedules keep their breakpoints only
+    if (end - start >= MAX_TABLE) {
+        table.clear();
+        times = t;
+        values = x;
+        return;
+    }
+
+    // Otherwise the breakpoints are not needed once tabled
+    times.clear();
+    values.clear();
+
+    // One value per time step from the first to the last breakpoint
+    table.assign(end - start + 1u, x.back());
+
+    // For each gap between breakpoints...
+    for (size_t i = 0u; i + 1u < t.size(); ++i) {
+
+        // Bounds of the gap
+        const size_t t0 = t[i] - start;
+        const size_t t1 = t[i + 1u] - start;
+
+        // Values at the bounds
+        const double x0 = x[i];
+        const double dx = mode == Step ? 0.0 : (x[i + 1u] - x0) / static_cast<double>(t1 - t0);
+
+        // Fill it
+        for (size_t u = t0; u < t1; ++u) table[u] = x0 + dx * static_cast<double>(u - t0);
+
+    }
+}
+
+// Function to find the value at a given time from the breakpoints
+double Schedule::search(const size_t &t) const {
+
+    // t: time step
+
+    // Note: This gives the same values as the table would.
+
+    // Check
+    assert(!times.empty());
+
+    // Outside the breakpoints
+    if (t <= times.front()) return values.front();
+    if (t >= times.back()) return values.back();
+
+    // Last breakpoint before (or at) that time
+    const size_t i = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), t) - times.begin()) - 1u;
+
+    // Value at that breakpoint
+    const double x0 = values[i];
+    if (mode == Step) return x0;
+
+    // Interpolate towards the next one
+    const double dx = (values[i + 1u] - x0) / static_cast<double>(times[i + 1u] - times[i]);
+    return x0 + dx * static_cast<double>(t - times[i]);
+
+}
@@ -0,0 +1,86 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_SCHEDULE_HPP
+#define READPARS_SCHEDULE_HPP
+
+// This header contains the Schedule class, a parameter whose value changes
+// over time, given as time:value breakpoints, e.g.:
+//
+//   temperature schedule 0:10 500:12 1000:15
+//   harvest schedule step 0:0 200:1 300:0
+//
+// Note: By default values are interpolated linearly between breakpoints,
+// while "step" keeps each value until the next breakpoint. Either way, the
+// value at every time step between the first and last breakpoints is
+// computed once when the line is read, so that getting the value at a
+// given time (e.g. in every generation of a simulation) is a single
+// lookup in a table. Before the first breakpoint the first value applies,
+// and after the last breakpoint the last value.
+
+// Note: Schedules spanning more than a million time steps are not tabled
+// (a single line could otherwise allocate any amount of memory), and their
+// values are found by binary search over the breakpoints instead.
+
+#include "readpars.hpp"
+
+#include <algorithm>
+
+class Schedule {
+
+public:
+
+    // Ways of filling the gaps between breakpoints
+    enum Mode { Linear, Step };
+
+    // Constructor
+    Schedule();
+
+    // Setters
+    void read(ReadPars&);
+    void set(const std::vector<size_t>&, const std::vector<double>&, const Mode& = Linear);
+
+    // Getters
+    size_t getstart() const { return start; }
+    size_t getend() const { return end; }
+    Mode getmode() const { return mode; }
+
+    // Function to get the value at a given time
+    double getvalue(const size_t &t) const {
+
+        // t: time step
+
+        // Search the breakpoints if there is no table
+        if (table.empty()) return search(t);
+
+        // Look it up
+        return table[t <= start ? 0u : std::min(t - start, table.size() - 1u)];
+
+    }
+
+private:
+
+    // Members
+    Mode mode;
+    size_t start;
+    size_t end;
+    std::vector<double> table;
+
+    // Breakpoints (kept only if there is no table)
+    std::vector<size_t> times;
+    std::vector<double> values;
+
+    // Private getters
+    double search(const size_t&) const;
+
+};
+
+#endif
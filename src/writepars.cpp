@@ -0,0 +1,218 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// Source code of the WritePars class.
+
+#include "writepars.hpp"
+
+// Size of the output buffer (flushed to the file whenever it is full)
+static const size_t BUFFER_SIZE = 1u << 20u;
+
+// Constructor
+WritePars::WritePars(const std::string &filename) :
+    filename(filename),
+    file(std::ofstream()),
+    count(0u),
+    buffer(std::vector<char>()),
+    used(0u)
+{
+
+    // filename: name of the file to write
+
+}
+
+// Destructor
+WritePars::~WritePars() {
+
+    // Note: Errors cannot be reported from here, so remember to close the
+    // file explicitly to know whether everything was written.
+
+    // Write what is left
+    if (isopen()) {
+        try { close(); } catch (...) {}
+    }
+}
+
+// Error messages
+std::string WritePars::errorOpenFile() const { return "Unable to open file " + filename; }
+std::string WritePars::errorWriteFile() const { return "Unable to write to file " + filename; }
+std::string WritePars::errorWriteName(const std::string &name) const { return "Invalid parameter name " + name + " in line " + std::to_string(count + 1u) + " of file " + filename; }
+std::string WritePars::errorWriteValue(const std::string &name) const { return "Invalid value for parameter " + name + " in line " + std::to_string(count + 1u) + " of file " + filename; }
+
+// Function to open the file
+void WritePars::open() {
+
+    // Open the file
+    file.open(filename.c_str(), std::ios::binary);
+
+    // Check if the file is open
+    if (!isopen())
+        throw std::runtime_error(errorOpenFile());
+
+    // Prepare the buffer
+    buffer.resize(BUFFER_SIZE);
+    used = 0u;
+
+    // Check
+    assert(count == 0u);
+
+}
+
+// Function to write the buffer into the file
+void WritePars::flush() {
+
+    // Write
+    file.write(buffer.data(), static_cast<std::streamsize>(used));
+
+    // Check
+    if (!file.good())
+        throw std::runtime_error(errorWriteFile());
+
+    // Empty the buffer
+    used = 0u;
+
+}
+
+// Function to make sure some more characters fit in the buffer
+void WritePars::reserve(const size_t &n) {
+
+    // n: number of characters to fit
+
+    // Check
+    assert(isopen());
+
+    // Flush if needed
+    if (used + n > buffer.size()) flush();
+
+    // Grow if still needed (e.g. very long comments)
+    if (n > buffer.size()) buffer.resize(n);
+
+}
+
+// Function to check that a parameter name can be read back
+void WritePars::checkname(const std::string &name) const {
+
+    // name: name of the parameter
+
+    // Check
+    if (name.empty() || !ReadPars::isvalid(name))
+        throw std::runtime_error(errorWriteName(name));
+
+}
+
+// Function to start a line with a parameter name
+void WritePars::writename(const std::string &name) {
+
+    // name: name of the parameter
+
+    // Make room
+    reserve(name.size());
+
+    // Copy
+    std::memcpy(buffer.data() + used, name.data(), name.size());
+    used += name.size();
+
+}
+
+// Function to end a line
+void WritePars::endline() {
+
+    // Make room
+    reserve(1u);
+
+    // New line
+    buffer[used++] = '\n';
+
+    // Increment line count
+    ++count;
+
+}
+
+// Function to write a comment line
+void WritePars::writecomment(const std::string &text) {
+
+    // text: content of the comment (without the leading #)
+
+    // Check that it stays on a single line
+    assert(text.find('\n') == std::string::npos);
+
+    // Make room
+    reserve(text.size() + 2u);
+
+    // Write
+    buffer[used++] = '#';
+    if (!text.empty()) buffer[used++] = ' ';
+    std::memcpy(buffer.data() + used, text.data(), text.size());
+    used += text.size();
+
+    // End the line
+    endline();
+
+}
+
+// Function to write a whole parameter set
+void WritePars::writeset(const ParSet &pars) {
+
+    // pars: parameters to write
+
+    // For each parameter in file order...
+    for (size_t i = 0u; i < pars.size(); ++i) {
+
+        // Name of the parameter
+        const std::string name = pars.getname(i);
+
+        // Stored values
+        const char *block = pars.getblock(i);
+        const size_t n = pars.getcount(i);
+
+        // A parameter without values could not be read back
+        if (n == 0u)
+            throw std::runtime_error(errorWriteValue(name));
+
+        // Check first, so nothing is written in case of error
+        checkname(name);
+        if (pars.gettype(i) == ParSet::Double)
+            for (size_t j = 0u; j < n; ++j)
+                checknumber(name, reinterpret_cast<const double*>(block)[j]);
+
+        // Write the name
+        writename(name);
+
+        // Write the values with their stored type
+        for (size_t j = 0u; j < n; ++j) {
+            switch (pars.gettype(i)) {
+                case ParSet::Integer: writenumber(reinterpret_cast<const int64_t*>(block)[j]); break;
+                case ParSet::Unsigned: writenumber(reinterpret_cast<const uint64_t*>(block)[j]); break;
+                case ParSet::Boolean: writenumber(reinterpret_cast<const bool*>(block)[j]); break;
+                default: writenumber(reinterpret_cast<const double*>(block)[j]);
+            }
+        }
+
+        // End the line
+        endline();
+
+    }
+}
+
+// Function to close the output file
+void WritePars::close() {
+
+    // Write what is left
+    flush();
+
+    // Close
+    file.close();
+
+    // Release the buffer
+    buffer.clear();
+    buffer.shrink_to_fit();
+
+}
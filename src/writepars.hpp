@@ -0,0 +1,194 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+#ifndef READPARS_WRITEPARS_HPP
+#define READPARS_WRITEPARS_HPP
+
+// This header contains the WritePars class, the writing counterpart of
+// ReadPars, used e.g. to save the parameters a simulation ran with.
+
+// Note: Numbers are written in their shortest form that reads back into
+// exactly the same value, so that a file written by WritePars and read by
+// ReadPars gives back the same parameters, and writing those again gives
+// back the same file, byte for byte. Integers are written in full, and read back
+// exactly by ReadPars (without going through a double), however large.
+
+#include "parset.hpp"
+
+#include <charconv>
+#include <fstream>
+
+class WritePars {
+
+public:
+
+    // Constructor
+    WritePars(const std::string&);
+
+    // Destructor
+    ~WritePars();
+
+    // Setters
+    void open();
+    void close();
+
+    // Writers
+    void writecomment(const std::string&);
+    void writeset(const ParSet&);
+
+    // Getters
+    bool isopen() const { return file.is_open(); }
+    size_t getcount() const { return count; }
+    std::string getfilename() const { return filename; }
+
+    // Function to write a single value
+    template <typename T>
+    void writevalue(const std::string &name, const T &value) {
+
+        // name: name of the parameter
+        // value: value to write
+
+        // Check first, so nothing is written in case of error
+        checkname(name);
+        checknumber(name, value);
+
+        // Write the name
+        writename(name);
+
+        // Write the value
+        writenumber(value);
+
+        // End the line
+        endline();
+
+    }
+
+    // Function to write a vector of values
+    template <typename T>
+    void writevalues(const std::string &name, const std::vector<T> &values) {
+
+        // name: name of the parameter
+        // values: values to write
+
+        // A parameter without values could not be read back
+        if (values.empty())
+            throw std::runtime_error(errorWriteValue(name));
+
+        // Check first, so nothing is written in case of error
+        checkname(name);
+        for (size_t i = 0u; i < values.size(); ++i)
+            checknumber(name, static_cast<T>(values[i]));
+
+        // Write the name
+        writename(name);
+
+        // Write the values
+        for (size_t i = 0u; i < values.size(); ++i)
+            writenumber(static_cast<T>(values[i]));
+
+        // End the line
+        endline();
+
+    }
+
+private:
+
+    // File members
+    std::string filename;
+    std::ofstream file;
+
+    // Line counter
+    size_t count;
+
+    // Output buffer
+    std::vector<char> buffer;
+    size_t used;
+
+    // Private setters
+    void flush();
+    void reserve(const size_t&);
+    void writename(const std::string&);
+    void endline();
+
+    // Checkers
+    void checkname(const std::string&) const;
+
+    // Error messages
+    std::string errorOpenFile() const;
+    std::string errorWriteFile() const;
+    std::string errorWriteName(const std::string&) const;
+    std::string errorWriteValue(const std::string&) const;
+
+    // Function to check that a number can be read back
+    template <typename T>
+    void checknumber(const std::string &name, const T &value) const {
+
+        // name: name of the parameter (for error messages)
+        // value: value to check
+
+        // Check
+        static_assert(std::is_arithmetic_v<T>, "Parameters must be numbers");
+
+        // Non-finite numbers cannot be read back
+        if constexpr (std::is_floating_point_v<T>)
+            if (!std::isfinite(value))
+                throw std::runtime_error(errorWriteValue(name));
+
+    }
+
+    // Function to write a number after the current content
+    template <typename T>
+    void writenumber(const T &value) {
+
+        // value: value to write
+
+        // Make room for a separator and the longest number
+        reserve(32u);
+
+        // Separator
+        buffer[used++] = ' ';
+
+        // Start of the number
+        char *first = buffer.data() + used;
+        char *last = buffer.data() + buffer.size();
+
+        // Convert (booleans as zero or one)
+        std::to_chars_result result;
+        if constexpr (std::is_same_v<T, bool>) result = std::to_chars(first, last, value ? 1 : 0);
+        else if constexpr (std::is_floating_point_v<T>) result = std::to_chars(first, last, static_cast<double>(value));
+        else result = std::to_chars(first, last, value);
+
+        // Check
+        assert(result.ec == std::errc());
+
+        // Number of characters written
+        size_t n = static_cast<size_t>(result.ptr - first);
+
+        // Remove the plus sign of positive exponents (e.g. 1e+20 into 1e20),
+        // as it is not an allowed character in parameter files
+        if constexpr (std::is_floating_point_v<T>) {
+            for (size_t i = 0u; i < n; ++i) {
+                if (first[i] == '+') {
+                    std::memmove(first + i, first + i + 1u, n - i - 1u);
+                    --n;
+                    break;
+                }
+            }
+        }
+
+        // Move on
+        used += n;
+
+    }
+
+};
+
+#endif
@@ -0,0 +1,102 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the sharing of parameters between processes
+
+#include "testutils.hpp"
+#include "../src/broadcast.hpp"
+#include <boost/test/unit_test.hpp>
+
+#ifndef _WIN32
+
+// Test that every process receives the parameters read by the root
+BOOST_AUTO_TEST_CASE(broadcastLocal) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "ngenes 4\nmutrate 0.01\ngenes 1.0 1.2 3.5 2.0\nseed 9007199254740993");
+
+    // Start four processes
+    ForkTransport transport(4);
+
+    // Parse once and share
+    ParSet pars = bcastpars("parameters.txt", transport);
+
+    // Read values
+    int ngenes = 0;
+    long long seed = 0;
+    std::vector<double> genes;
+    pars.getvalue<int>("ngenes", ngenes);
+    pars.getvalues<double>("genes", genes, 4u);
+    pars.getvalue<long long>("seed", seed);
+
+    // Other processes report back through their exit status
+    if (transport.getrank() != 0)
+        transport.leave(ngenes == 4 && genes[3u] == 2.0 && seed == 9007199254740993ll && pars.getfilename() == "parameters.txt");
+
+    // Check on the root
+    BOOST_CHECK_EQUAL(ngenes, 4);
+    BOOST_CHECK_EQUAL(transport.join(), 0);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that every process gets the error if the root cannot parse the file
+BOOST_AUTO_TEST_CASE(broadcastLocalError) {
+
+    // Start four processes
+    ForkTransport transport(4);
+
+    // Parse once and share (failing)
+    std::string message;
+    try {
+        bcastpars("nonexistent.txt", transport);
+    } catch (const std::exception &e) {
+        message = e.what();
+    }
+
+    // Other processes report back through their exit status
+    if (transport.getrank() != 0)
+        transport.leave(message == "Unable to open file nonexistent.txt");
+
+    // Check on the root
+    BOOST_CHECK_EQUAL(message, "Unable to open file nonexistent.txt");
+    BOOST_CHECK_EQUAL(transport.join(), 0);
+
+}
+
+// Test that processes throwing past their transport exit with a failure
+BOOST_AUTO_TEST_CASE(broadcastLocalThrow) {
+
+    // Number of processes that failed
+    int failed = -1;
+
+    // Start three processes, the others throwing (they exit before
+    // reaching the catch block)
+    try {
+        ForkTransport transport(3);
+        if (transport.getrank() != 0) throw std::runtime_error("Failure");
+        failed = transport.join();
+    } catch (const std::exception&) {
+        std::_Exit(0);
+    }
+
+    // Check on the root
+    BOOST_CHECK_EQUAL(failed, 2);
+
+}
+
+// Test that only the first process can be the root of a local run
+BOOST_AUTO_TEST_CASE(broadcastLocalRoot) {
+
+    // Single process
+    ForkTransport transport(1);
+
+    // Check error
+    std::vector<char> buffer;
+    tst::checkError([&]() { transport.broadcast(buffer, 1); }, "Only the first process can broadcast in a local run");
+
+}
+
+#endif
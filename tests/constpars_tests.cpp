@@ -0,0 +1,207 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test reading embedded parameters at compile time
+
+#include "testutils.hpp"
+#include "../src/constpars.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Parameters with defaults embedded in the program
+struct Defaults {
+
+    size_t popsize = 0u;
+    double mutrate = 0.0;
+    int shift = 0;
+    bool sexual = false;
+    std::array<double, 3u> traits = {};
+
+};
+
+// Function to check that a value is a proportion
+constexpr const char* checkproportion(const double &x) { return x >= 0.0 && x <= 1.0 ? "" : "must be between 0 and 1"; }
+
+// Function to read the defaults
+constexpr Defaults readdefaults(const std::string_view &text) {
+
+    // text: embedded parameters
+
+    // Prepare
+    Defaults pars;
+    ConstPars reader(text, "defaults");
+
+    // For each line...
+    while (!reader.iseof()) {
+
+        // Read the line
+        reader.readline();
+
+        // Skip empty and comment lines
+        if (reader.isempty() || reader.iscomment()) continue;
+
+        // Read the right parameter
+        if (reader.getname() == "popsize") reader.readvalue(pars.popsize);
+        else if (reader.getname() == "mutrate") reader.readvalue(pars.mutrate, checkproportion);
+        else if (reader.getname() == "shift") reader.readvalue(pars.shift);
+        else if (reader.getname() == "sexual") reader.readvalue(pars.sexual);
+        else if (reader.getname() == "traits") reader.readvalues(pars.traits);
+        else reader.readerror();
+
+    }
+
+    return pars;
+
+}
+
+// Defaults read when compiling
+constexpr Defaults defaults = readdefaults(
+    "# Embedded defaults\n"
+    "popsize 100\n"
+    "mutrate 0.01\n"
+    "\n"
+    "shift -3\n"
+    "sexual 1\n"
+    "traits 1.5 2e-3 -0.25\n"
+);
+
+// Check the defaults at compile time
+static_assert(defaults.popsize == 100u);
+static_assert(defaults.mutrate == 0.01);
+static_assert(defaults.shift == -3);
+static_assert(defaults.sexual);
+static_assert(defaults.traits[1u] == 0.002);
+
+// Function to parse a number at compile time
+constexpr double parse(const std::string_view &text) {
+
+    // text: number to parse
+
+    double x = 0.0;
+    if (!ConstPars::parse(text, x)) throw std::runtime_error("Invalid number");
+    return x;
+
+}
+
+// Numbers must match the usual conversion exactly
+static_assert(parse("0.1") == 0.1);
+static_assert(parse("-12.5e3") == -12500.0);
+static_assert(parse("123456789012345") == 123456789012345.0);
+static_assert(parse("1e22") == 1e22);
+static_assert(parse("3.14159") == 3.14159);
+static_assert(parse("000.000") == 0.0);
+
+// Test that the defaults are read the same at run time
+BOOST_AUTO_TEST_CASE(constparsRuntime) {
+
+    // Read at run time
+    const Defaults pars = readdefaults("popsize 100\nmutrate 0.01\nshift -3\nsexual 1\ntraits 1.5 2e-3 -0.25");
+
+    // Check
+    BOOST_CHECK_EQUAL(pars.popsize, defaults.popsize);
+    BOOST_CHECK_EQUAL(pars.mutrate, defaults.mutrate);
+    BOOST_CHECK_EQUAL(pars.shift, defaults.shift);
+    BOOST_CHECK_EQUAL(pars.sexual, defaults.sexual);
+    BOOST_CHECK_EQUAL(pars.traits[2u], -0.25);
+
+}
+
+// Test that numbers match the usual conversion
+BOOST_AUTO_TEST_CASE(constparsNumbers) {
+
+    // Numbers to compare
+    const std::vector<std::string> numbers = {
+        "0", "1", "-1", "0.5", "1.1", "99.99", "1e-5", "2.5E6", "-0.001",
+        "1234.5678", "6.02214076e23", "1.7976931348623157e308", "4.9e-324",
+        "0.30000000000000004", "12345678901234567890", "1e-22"
+    };
+
+    // For each one...
+    for (const std::string &number : numbers) {
+
+        // Both ways
+        double x = 0.0, y = 0.0;
+        BOOST_CHECK(ConstPars::parse(number, x));
+        BOOST_CHECK(ReadPars::parse(number, y));
+        BOOST_CHECK_EQUAL(x, y);
+
+    }
+
+    // Invalid numbers
+    double x;
+    BOOST_CHECK(!ConstPars::parse("", x));
+    BOOST_CHECK(!ConstPars::parse("-", x));
+    BOOST_CHECK(!ConstPars::parse(".", x));
+    BOOST_CHECK(!ConstPars::parse("1.2.3", x));
+    BOOST_CHECK(!ConstPars::parse("1e", x));
+    BOOST_CHECK(!ConstPars::parse("abc", x));
+    BOOST_CHECK(!ConstPars::parse("1x", x));
+
+}
+
+// Test the errors (compile errors when read at compile time)
+BOOST_AUTO_TEST_CASE(constparsErrors) {
+
+    // Check error messages
+    tst::checkError([&] { readdefaults(""); }, "File defaults is empty");
+    tst::checkError([&] { readdefaults("popsize 100\nmutrate"); }, "No value for parameter mutrate in line 2 of file defaults");
+    tst::checkError([&] { readdefaults("popsize 10.5"); }, "Invalid value type for parameter popsize in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("popsize -1"); }, "Invalid value type for parameter popsize in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("mutrate 2"); }, "Parameter mutrate must be between 0 and 1 in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("popsize 1 2"); }, "Too many values for parameter popsize in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("traits 1 2"); }, "Too few values for parameter traits in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("traits 1 2 3 4"); }, "Too many values for parameter traits in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("sexual 2"); }, "Invalid value type for parameter sexual in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("growth 1"); }, "Invalid parameter: growth in line 1 of file defaults");
+    tst::checkError([&] { readdefaults("popsize @"); }, "Could not read value for parameter popsize in line 1 of file defaults");
+
+}
+
+// Test that the rules shared with ReadPars hold at compile time
+BOOST_AUTO_TEST_CASE(constparsSharedRules) {
+
+    // Function to coerce at compile time
+    constexpr auto coerces = [](const double &x) { int y = 0; return ReadPars::coerce(x, y); };
+
+    // Whole numbers within range only
+    static_assert(coerces(-3.0));
+    static_assert(!coerces(1.5));
+    static_assert(!coerces(3e9));
+
+    // Same characters and word splitting
+    static_assert(ReadPars::isvalid("1.5e-3") && !ReadPars::isvalid("1,5"));
+    constexpr auto second = []() { size_t cursor = 0u; ReadPars::nextword("a \t b\r", cursor); return ReadPars::nextword("a \t b\r", cursor); };
+    static_assert(second() == "b");
+
+    // The same values are rejected at run time by both readers
+    int y;
+    ReadPars reader("parameters.txt");
+    reader.open("shift 3e9\n");
+    reader.readline();
+    tst::checkError([&]() { reader.readvalue<int>(y); }, "Invalid value type for parameter shift in line 1 of file parameters.txt");
+    tst::checkError([&]() { readdefaults("shift 3e9"); }, "Invalid value type for parameter shift in line 1 of file defaults");
+
+}
+
+// Test text with Windows line endings
+BOOST_AUTO_TEST_CASE(constparsWindowsLineEndings) {
+
+    // Text with a blank line and a comment
+    constexpr std::string_view text = "# Defaults\r\npopsize 100\r\n\r\nmutrate 0.02\r\n";
+
+    // Read at compile time
+    constexpr Defaults crlf = readdefaults(text);
+    static_assert(crlf.popsize == 100u);
+    static_assert(crlf.mutrate == 0.02);
+
+    // As ReadPars does at run time
+    size_t popsize = 0u;
+    ReadPars reader("defaults");
+    reader.open(std::string(text));
+    while (!reader.iseof()) {
+        reader.readline();
+        if (reader.isempty() || reader.iscomment()) continue;
+        if (reader.getname() == "popsize") reader.readvalue<size_t>(popsize);
+    }
+    BOOST_CHECK_EQUAL(popsize, crlf.popsize);
+
+}
@@ -0,0 +1,92 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the fingerprints of parameter sets
+
+#include "testutils.hpp"
+#include "../src/fingerprint.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Function to load a set from some text
+ParSet loadtext(const std::string &content) {
+
+    // content: content of the parameter file
+
+    // Write it
+    tst::write("parameters.txt", content);
+
+    // Load it
+    ParSet pars;
+    pars.load("parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+    return pars;
+
+}
+
+// Test that the fingerprint ignores the formatting of the file
+BOOST_AUTO_TEST_CASE(fingerprintFormatting) {
+
+    // Same parameters, written differently
+    const Fingerprint a = fingerprint(loadtext("ngenes 4\nmutrate 0.01\ngenes 1.0 1.2 3.5 -0"));
+    const Fingerprint b = fingerprint(loadtext("# Comment\n\ngenes   1 1.20 3.5e0 0\nmutrate 1e-2\nngenes 4.0"));
+    const Fingerprint c = fingerprint(loadtext("ngenes 3\nmutrate 0.01\nngenes 4\ngenes 1 1.2 3.5 0\n"));
+
+    // Check
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a == c);
+    BOOST_CHECK_EQUAL(a.str().size(), 32u);
+
+}
+
+// Test that the fingerprint depends on the content
+BOOST_AUTO_TEST_CASE(fingerprintContent) {
+
+    // Reference
+    const Fingerprint a = fingerprint(loadtext("ngenes 4\ngenes 1 2 3 4"));
+
+    // Check that changes in names, values or number of values are detected
+    BOOST_CHECK(a != fingerprint(loadtext("ngenes 4\ngenes 1 2 3 5")));
+    BOOST_CHECK(a != fingerprint(loadtext("ngene 4\ngenes 1 2 3 4")));
+    BOOST_CHECK(a != fingerprint(loadtext("ngenes 4 1\ngenes 2 3 4")));
+    BOOST_CHECK(a != fingerprint(loadtext("ngenes 4")));
+
+    // Check that the fingerprint is stable across runs and machines
+    BOOST_CHECK_EQUAL(a.str(), "4d69c3b76923ea994ce875fba60ab5f0");
+
+}
+
+// Test that stored types do not matter
+BOOST_AUTO_TEST_CASE(fingerprintTypes) {
+
+    // Same values stored with different types
+    ParBuilder b1, b2;
+    b1.add<int>("ngenes", { 4 });
+    b1.add<bool>("verbose", { true });
+    b2.add<double>("ngenes", { 4.0 });
+    b2.add<size_t>("verbose", { 1u });
+
+    // Check
+    BOOST_CHECK(fingerprint(b1.build()) == fingerprint(b2.build()));
+
+}
+
+// Test that integers too large for doubles are told apart
+BOOST_AUTO_TEST_CASE(fingerprintLargeIntegers) {
+
+    // Seeds that would be the same as doubles
+    const Fingerprint a = fingerprint(loadtext("seed 9007199254740992"));
+    const Fingerprint b = fingerprint(loadtext("seed 9007199254740993"));
+    const Fingerprint c = fingerprint(loadtext("seed 18446744073709551615"));
+    const Fingerprint d = fingerprint(loadtext("seed 18446744073709551614"));
+
+    // Check
+    BOOST_CHECK(a != b);
+    BOOST_CHECK(c != d);
+
+    // Integers exact as doubles still match their double form
+    BOOST_CHECK(a == fingerprint(loadtext("seed 9007199254740992.0")));
+
+}
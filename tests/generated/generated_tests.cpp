@@ -0,0 +1,63 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test a parser generated from a schema when building (see
+// schema.txt in this folder, and readpars_generate in tools/)
+
+#include "testutils.hpp"
+#include "Model.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test that the generated parser reads parameters and fills in defaults
+BOOST_AUTO_TEST_CASE(generatedRead) {
+
+    // Write a parameter file (without the optional popsize)
+    tst::write("parameters.txt", "# Model\nmutrate 0.02\ngenes 1 2 3 4\npop.growth 1.5\n");
+
+    // Read it
+    Model pars;
+    pars.read("parameters.txt");
+
+    // Check
+    BOOST_CHECK_EQUAL(pars.popsize, 100u);
+    BOOST_CHECK_EQUAL(pars.mutrate, 0.02);
+    BOOST_CHECK_EQUAL(pars.genes.size(), 4u);
+    BOOST_CHECK_EQUAL(pars.genes[3u], 4.0);
+    BOOST_CHECK_EQUAL(pars.pop_growth, 1.5);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test errors caught by the generated parser
+BOOST_AUTO_TEST_CASE(generatedErrors) {
+
+    // Prepare
+    Model pars;
+    auto read = [&]() { pars.read("parameters.txt"); };
+
+    // Unknown name
+    tst::write("parameters.txt", "genes 1 2 3 4\npop.growth 1\nselection 1");
+    tst::checkError(read, "Invalid parameter: selection in line 3 of file parameters.txt");
+
+    // Duplicate
+    tst::write("parameters.txt", "genes 1 2 3 4\npop.growth 1\ngenes 1 2 3 4");
+    tst::checkError(read, "Duplicate parameter genes in line 3 of file parameters.txt");
+
+    // Failing check
+    tst::write("parameters.txt", "mutrate 2\ngenes 1 2 3 4\npop.growth 1");
+    tst::checkError(read, "Parameter mutrate must be between 0 and 1 in line 1 of file parameters.txt");
+
+    // Wrong number of values
+    tst::write("parameters.txt", "genes 1 2 3\npop.growth 1");
+    tst::checkError(read, "Too few values for parameter genes in line 1 of file parameters.txt");
+
+    // Missing required parameter
+    tst::write("parameters.txt", "genes 1 2 3 4");
+    tst::checkError(read, "Missing parameter pop.growth in file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
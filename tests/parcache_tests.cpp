@@ -0,0 +1,259 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the cache of parsed parameter files
+
+#include "testutils.hpp"
+#include "../src/parcache.hpp"
+#include <boost/test/unit_test.hpp>
+#include <thread>
+#include <latch>
+
+// Test that loading a file twice only parses it once
+BOOST_AUTO_TEST_CASE(cacheHit) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "ngenes 4\nmutrate 0.01");
+
+    // Create a cache
+    ParCache cache(1u << 20u);
+
+    // Load the file twice
+    ParSet a = cache.load("parameters.txt");
+    ParSet b = cache.load("./parameters.txt");
+
+    // Check that the same parsed set is shared
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+    BOOST_CHECK_EQUAL(cache.gethits(), 1u);
+    BOOST_CHECK_EQUAL(cache.getmisses(), 1u);
+    BOOST_CHECK_EQUAL(a.data(), b.data());
+    BOOST_CHECK_EQUAL(cache.getbytes(), a.bytes());
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that a modified file is parsed again
+BOOST_AUTO_TEST_CASE(cacheModifiedFile) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "ngenes 4");
+
+    // Create a cache
+    ParCache cache(1u << 20u);
+
+    // Load it
+    ParSet a = cache.load("parameters.txt");
+
+    // Modify the file
+    tst::write("parameters.txt", "ngenes 10");
+
+    // Load it again
+    ParSet b = cache.load("parameters.txt");
+
+    // Check
+    int ngenes;
+    b.getvalue<int>("ngenes", ngenes);
+    BOOST_CHECK_EQUAL(ngenes, 10);
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+    BOOST_CHECK_EQUAL(cache.getmisses(), 2u);
+
+    // The old copy is still valid
+    a.getvalue<int>("ngenes", ngenes);
+    BOOST_CHECK_EQUAL(ngenes, 4);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that a file is parsed again when a file it includes is modified
+BOOST_AUTO_TEST_CASE(cacheModifiedInclude) {
+
+    // Write a base file, a file including it and one including that one
+    tst::write("common.txt", "ngenes 4");
+    tst::write("model.txt", "include common.txt\nmutrate 0.01");
+    tst::write("parameters.txt", "include model.txt");
+
+    // Create a cache
+    ParCache cache(1u << 20u);
+
+    // Load it
+    cache.load("parameters.txt");
+
+    // Modify the base file
+    tst::write("common.txt", "ngenes 10");
+
+    // Load it again
+    ParSet pars = cache.load("parameters.txt");
+
+    // Check that the change made it through both levels of inclusion
+    int ngenes;
+    pars.getvalue<int>("ngenes", ngenes);
+    BOOST_CHECK_EQUAL(ngenes, 10);
+
+    // Loading it again without changes is a hit
+    const size_t hits = cache.gethits();
+    cache.load("parameters.txt");
+    BOOST_CHECK_EQUAL(cache.gethits(), hits + 1u);
+
+    // Remove the files
+    std::remove("common.txt");
+    std::remove("model.txt");
+    std::remove("parameters.txt");
+
+}
+
+// Test that the least recently used files are dropped
+BOOST_AUTO_TEST_CASE(cacheEviction) {
+
+    // Write parameter files
+    tst::write("parameters1.txt", "ngenes 4");
+    tst::write("parameters2.txt", "ngenes 5");
+    tst::write("parameters3.txt", "ngenes 6");
+
+    // Size of one parsed file
+    ParSet pars;
+    pars.load("parameters1.txt");
+
+    // Create a cache that fits two of them
+    ParCache cache(2u * pars.bytes() + 16u);
+
+    // Load all three, using the first one again in between
+    cache.load("parameters1.txt");
+    cache.load("parameters2.txt");
+    cache.load("parameters1.txt");
+    cache.load("parameters3.txt");
+
+    // The second one should have been dropped
+    BOOST_CHECK_EQUAL(cache.size(), 2u);
+    cache.load("parameters1.txt");
+    BOOST_CHECK_EQUAL(cache.gethits(), 2u);
+    cache.load("parameters2.txt");
+    BOOST_CHECK_EQUAL(cache.getmisses(), 4u);
+
+    // Shrinking the budget drops everything that does not fit
+    cache.setcapacity(0u);
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+    BOOST_CHECK_EQUAL(cache.getbytes(), 0u);
+
+    // Remove the files
+    std::remove("parameters1.txt");
+    std::remove("parameters2.txt");
+    std::remove("parameters3.txt");
+
+}
+
+// Test that the cache can be used from several threads
+BOOST_AUTO_TEST_CASE(cacheThreads) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "ngenes 4\ngenes 1 2 3 4");
+
+    // Start from an empty global cache
+    ParCache::global().clear();
+
+    // Load the file many times from several threads
+    std::vector<std::thread> threads;
+    std::vector<int> results(8u, 0);
+    for (size_t i = 0u; i < results.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < 100; ++j)
+                ParCache::global().load("parameters.txt").getvalue<int>("ngenes", results[i]);
+        });
+    }
+    for (std::thread &t : threads) t.join();
+
+    // Check
+    for (int x : results) BOOST_CHECK_EQUAL(x, 4);
+    BOOST_CHECK_EQUAL(ParCache::global().size(), 1u);
+    BOOST_CHECK_EQUAL(ParCache::global().gethits() + ParCache::global().getmisses(), 800u);
+
+    // Missing files give the usual error
+    tst::checkError([&]() { ParCache::global().load("nonexistent.txt"); }, "Unable to open file nonexistent.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that a file included by several threads at once is parsed once
+BOOST_AUTO_TEST_CASE(cacheThreadsShareParsing) {
+
+    // Write a large base and files including it
+    std::string text;
+    for (size_t i = 0u; i < 20000u; ++i) text += "par" + std::to_string(i) + " " + std::to_string(i) + "\n";
+    tst::write("common.txt", text);
+    const size_t n = 8u;
+    for (size_t i = 0u; i < n; ++i) tst::write("model" + std::to_string(i) + ".txt", "include common.txt\nseed " + std::to_string(i));
+
+    // Start from an empty global cache
+    ParCache::global().clear();
+
+    // Load all of them at once
+    std::latch start(n);
+    std::vector<std::thread> threads;
+    std::vector<int> results(n, 0), seeds(n, -1);
+    for (size_t i = 0u; i < n; ++i) {
+        threads.emplace_back([&, i]() {
+            start.arrive_and_wait();
+            const ParSet pars = ParCache::global().load("model" + std::to_string(i) + ".txt");
+            pars.getvalue<int>("par19999", results[i]);
+            pars.getvalue<int>("seed", seeds[i]);
+        });
+    }
+    for (std::thread &t : threads) t.join();
+
+    // Check the values
+    for (size_t i = 0u; i < n; ++i) {
+        BOOST_CHECK_EQUAL(results[i], 19999);
+        BOOST_CHECK_EQUAL(seeds[i], static_cast<int>(i));
+    }
+
+    // The base was parsed once, along with each model
+    BOOST_CHECK_EQUAL(ParCache::global().getmisses(), n + 1u);
+    BOOST_CHECK_EQUAL(ParCache::global().gethits(), n - 1u);
+
+    // Remove the files
+    std::remove("common.txt");
+    for (size_t i = 0u; i < n; ++i) std::remove(("model" + std::to_string(i) + ".txt").c_str());
+
+}
+
+// Test that files including each other do not block threads
+BOOST_AUTO_TEST_CASE(cacheThreadsCircular) {
+
+    // Write files including each other
+    tst::write("model1.txt", "include model2.txt\nseed 1");
+    tst::write("model2.txt", "include model1.txt\nseed 2");
+
+    // Start from an empty global cache
+    ParCache::global().clear();
+
+    // Load them from two threads at once, many times
+    for (int k = 0; k < 50; ++k) {
+
+        std::latch start(2);
+        std::vector<int> errors(2u, 0);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 2; ++i) {
+            threads.emplace_back([&, i]() {
+                start.arrive_and_wait();
+                try { ParCache::global().load("model" + std::to_string(i + 1) + ".txt"); }
+                catch (const std::runtime_error &e) { errors[i] = std::string(e.what()).find("Circular inclusion") != std::string::npos; }
+            });
+        }
+        for (std::thread &t : threads) t.join();
+
+        // Both get the error
+        BOOST_CHECK_EQUAL(errors[0], 1);
+        BOOST_CHECK_EQUAL(errors[1], 1);
+
+    }
+
+    // Remove the files
+    std::remove("model1.txt");
+    std::remove("model2.txt");
+
+}
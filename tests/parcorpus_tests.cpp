@@ -0,0 +1,123 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the generation of synthetic parameter files
+
+#include "testutils.hpp"
+#include "../src/parcorpus.hpp"
+#include "../src/readpars.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test that the same shape always gives the same file
+BOOST_AUTO_TEST_CASE(corpusDeterministic) {
+
+    // Shape of the files
+    ParCorpus::Shape shape;
+    shape.nparams = 500u;
+    shape.seed = 7u;
+
+    // Generate twice, and once into a file
+    ParCorpus corpus(shape);
+    const std::string first = corpus.generate();
+    const std::string second = ParCorpus(shape).generate();
+    corpus.write("corpus.txt");
+
+    // Check
+    BOOST_CHECK(!first.empty());
+    BOOST_CHECK_EQUAL(first, second);
+    BOOST_CHECK_EQUAL(tst::readtext("corpus.txt"), first);
+
+    // Another seed gives another file
+    shape.seed = 8u;
+    BOOST_CHECK(ParCorpus(shape).generate() != first);
+
+    // Remove the file
+    std::remove("corpus.txt");
+
+}
+
+// Test that the files have the requested shape and can be read
+BOOST_AUTO_TEST_CASE(corpusShape) {
+
+    // Shape of the files
+    ParCorpus::Shape shape;
+    shape.nparams = 1000u;
+    shape.vectors = 0.5;
+    shape.maxlength = 20u;
+    shape.comments = 0.2;
+    shape.blanks = 0.1;
+
+    // Generate
+    ParCorpus corpus(shape);
+    const std::string text = corpus.generate();
+
+    // Read it back
+    ReadPars reader("corpus.txt");
+    reader.open(text);
+    size_t nparams = 0u, nvectors = 0u, ncomments = 0u, nblanks = 0u;
+    std::vector<double> values;
+    while (!reader.iseof()) {
+
+        // Read a line
+        reader.readline();
+
+        // Count it
+        if (reader.iscomment()) { ++ncomments; continue; }
+        if (reader.isempty()) { ++nblanks; continue; }
+        ++nparams;
+
+        // Read all its values
+        reader.readall(values);
+        BOOST_CHECK(values.size() <= shape.maxlength);
+        nvectors += values.size() > 1u;
+
+    }
+
+    // Check
+    BOOST_CHECK_EQUAL(nparams, 1000u);
+    BOOST_CHECK_EQUAL(reader.getcount(), corpus.getnlines());
+    BOOST_CHECK(nvectors > 400u && nvectors < 600u);
+    BOOST_CHECK(ncomments > 150u && ncomments < 250u);
+    BOOST_CHECK(nblanks > 50u && nblanks < 150u);
+    BOOST_CHECK(corpus.geterrors().empty());
+
+}
+
+// Test that injected errors are where they are said to be
+BOOST_AUTO_TEST_CASE(corpusErrors) {
+
+    // Shape of the files
+    ParCorpus::Shape shape;
+    shape.nparams = 200u;
+    shape.errors = 0.1;
+
+    // Generate
+    ParCorpus corpus(shape);
+    const std::string text = corpus.generate();
+
+    // Check that there are errors
+    const std::vector<size_t> &errors = corpus.geterrors();
+    BOOST_REQUIRE(!errors.empty());
+
+    // Read it back, skipping over each error in turn
+    ReadPars reader("corpus.txt");
+    reader.open(text);
+    std::vector<double> values;
+    std::vector<size_t> found;
+    while (!reader.iseof()) {
+
+        // Try to read a line
+        try {
+            reader.readline();
+            if (reader.isempty() || reader.iscomment()) continue;
+            reader.readall(values);
+        }
+        catch (const std::runtime_error&) {
+            found.push_back(reader.getcount());
+        }
+    }
+
+    // Check
+    BOOST_CHECK_EQUAL_COLLECTIONS(found.begin(), found.end(), errors.begin(), errors.end());
+
+}
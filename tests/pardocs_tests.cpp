@@ -0,0 +1,123 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test files with multiple documents
+
+#include "testutils.hpp"
+#include "../src/pardocs.hpp"
+#include "../src/fingerprint.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test that documents are found and parsed separately
+BOOST_AUTO_TEST_CASE(docsParseEach) {
+
+    // Write a file with three documents
+    tst::write("parameters.txt", "ngenes 4\nmutrate 0.01\n---\n# Second run\nngenes 5\n---\nngenes 6\ngenes 1 2");
+
+    // Index the documents
+    ParDocs docs;
+    docs.load("parameters.txt");
+
+    // Check
+    BOOST_CHECK_EQUAL(docs.size(), 3u);
+    BOOST_CHECK_EQUAL(docs.getline(0u), 1u);
+    BOOST_CHECK_EQUAL(docs.getline(1u), 4u);
+    BOOST_CHECK_EQUAL(docs.getline(2u), 7u);
+
+    // Parse the second one
+    ParSet pars = docs.parse(1u);
+
+    // Read a value
+    int ngenes;
+    pars.getvalue<int>("ngenes", ngenes);
+
+    // Check
+    BOOST_CHECK_EQUAL(pars.size(), 1u);
+    BOOST_CHECK_EQUAL(ngenes, 5);
+    BOOST_CHECK_EQUAL(pars.getline(0u), 5u);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test files with Windows line endings
+BOOST_AUTO_TEST_CASE(docsWindowsLineEndings) {
+
+    // Write a file with two documents
+    tst::write("parameters.txt", "ngenes 4\r\ngenes 1 2 3 4\r\n---\r\nngenes 5\r\n");
+
+    // Index and parse the documents
+    ParDocs docs;
+    docs.load("parameters.txt");
+    const std::vector<ParSet> sets = docs.parseall(2u);
+
+    // Check
+    int ngenes;
+    std::vector<double> genes;
+    BOOST_CHECK_EQUAL(sets.size(), 2u);
+    sets[0u].getvalues<double>("genes", genes, 4u);
+    sets[1u].getvalue<int>("ngenes", ngenes);
+    BOOST_CHECK_EQUAL(genes[3u], 4.0);
+    BOOST_CHECK_EQUAL(ngenes, 5);
+    BOOST_CHECK_EQUAL(docs.getline(1u), 4u);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that parsing in parallel gives the same as one by one
+BOOST_AUTO_TEST_CASE(docsParseAll) {
+
+    // Build a file with many documents
+    std::string text;
+    for (int i = 0; i < 100; ++i)
+        text += "seed " + std::to_string(i) + "\nmutrate 0.01\ngenes 1 2 3 4\n---\n";
+    text += "seed 100\n";
+
+    // Write it
+    tst::write("parameters.txt", text);
+
+    // Index the documents
+    ParDocs docs;
+    docs.load("parameters.txt");
+
+    // Parse them all on several threads
+    const std::vector<ParSet> sets = docs.parseall(4u);
+
+    // Check
+    BOOST_CHECK_EQUAL(sets.size(), 101u);
+    for (size_t i = 0u; i < sets.size(); i += 10u)
+        BOOST_CHECK(fingerprint(sets[i]) == fingerprint(docs.parse(i)));
+
+    // Read a value
+    int seed;
+    sets[42u].getvalue<int>("seed", seed);
+    BOOST_CHECK_EQUAL(seed, 42);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that errors point to the line in the whole file
+BOOST_AUTO_TEST_CASE(docsErrors) {
+
+    // Write a file with an error in the second document
+    tst::write("parameters.txt", "ngenes 4\n---\nngenes 5\nmutrate abc\n---\nngenes x");
+
+    // Index the documents
+    ParDocs docs;
+    docs.load("parameters.txt");
+
+    // The first error in file order is reported
+    tst::checkError([&]() { docs.parseall(2u); }, "Invalid value type for parameter mutrate in line 4 of file parameters.txt");
+
+    // Missing file
+    tst::checkError([&]() { docs.load("nonexistent.txt"); }, "Unable to open file nonexistent.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
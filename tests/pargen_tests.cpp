@@ -0,0 +1,75 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the generation of parsers from schemas
+
+#include "testutils.hpp"
+#include "../src/pargen.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test the generated code
+BOOST_AUTO_TEST_CASE(genWriteParser) {
+
+    // Write a schema
+    tst::write("schema.txt", "popsize size 1 strictpos 100\nmutrate double 1 proportion 0.01\ngenes double 4 none\npop.growth double 1 none");
+
+    // Generate the code
+    const std::string code = genparser("schema.txt", "Model");
+
+    // Check the struct and its members
+    BOOST_CHECK(code.find("struct Model {") != std::string::npos);
+    BOOST_CHECK(code.find("size_t popsize = 100u;") != std::string::npos);
+    BOOST_CHECK(code.find("std::vector<double> genes = std::vector<double>(4u);") != std::string::npos);
+    BOOST_CHECK(code.find("double pop_growth = double();") != std::string::npos);
+
+    // Defaults are written exactly, within range of their type
+    tst::write("schema.txt", "seed long 1 none 9223372036854775807\nshift int 1 none -2147483648\nsizes size 2 none 18446744073709551615 1e3");
+    const std::string limits = genparser("schema.txt", "Model");
+    BOOST_CHECK(limits.find("long seed = 9223372036854775807;") != std::string::npos);
+    BOOST_CHECK(limits.find("int shift = (-2147483647 - 1);") != std::string::npos);
+    BOOST_CHECK(limits.find("18446744073709551615u, 1000u") != std::string::npos);
+
+    // Check the parser
+    BOOST_CHECK(code.find("reader.readvalues<double>(genes, 4u);") != std::string::npos);
+    BOOST_CHECK(code.find("if (!(x > 0)) throw std::runtime_error(\"Parameter popsize must be strictly positive\" + where);") != std::string::npos);
+    BOOST_CHECK(code.find("Missing parameter genes") != std::string::npos);
+    BOOST_CHECK(code.find("Missing parameter popsize") == std::string::npos);
+
+    // Remove the file
+    std::remove("schema.txt");
+
+}
+
+// Test errors in schemas
+BOOST_AUTO_TEST_CASE(genErrors) {
+
+    // Unknown type
+    tst::write("schema.txt", "popsize integer 1 none");
+    tst::checkError([]() { genparser("schema.txt"); }, "Invalid type for parameter popsize in line 1 of file schema.txt");
+
+    // Unknown check
+    tst::write("schema.txt", "popsize size 1 even");
+    tst::checkError([]() { genparser("schema.txt"); }, "Invalid check for parameter popsize in line 1 of file schema.txt");
+
+    // Default that does not fit the type
+    tst::write("schema.txt", "popsize size 1 none -1");
+    tst::checkError([]() { genparser("schema.txt"); }, "Invalid default value for parameter popsize in line 1 of file schema.txt");
+
+    // Defaults that only fit a larger type
+    tst::write("schema.txt", "x int 1 none 3000000000");
+    tst::checkError([]() { genparser("schema.txt"); }, "Invalid default value for parameter x in line 1 of file schema.txt");
+    tst::write("schema.txt", "x unsigned 3 none 1 2 4294967296");
+    tst::checkError([]() { genparser("schema.txt"); }, "Invalid default value for parameter x in line 1 of file schema.txt");
+
+    // Wrong number of defaults
+    tst::write("schema.txt", "genes double 4 none 1 2");
+    tst::checkError([]() { genparser("schema.txt"); }, "Wrong number of default values for parameter genes in line 1 of file schema.txt");
+
+    // Names that clash in C++
+    tst::write("schema.txt", "pop.size size 1 none\npop-size size 1 none");
+    tst::checkError([]() { genparser("schema.txt"); }, "Duplicate name for parameter pop-size in line 2 of file schema.txt");
+
+    // Remove the file
+    std::remove("schema.txt");
+
+}
@@ -0,0 +1,106 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test parameters computed from other parameters
+
+#include "testutils.hpp"
+#include "../src/pargraph.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test that expressions are evaluated after what they depend on
+BOOST_AUTO_TEST_CASE(graphEvaluate) {
+
+    // Write a parameter file (with references to later lines)
+    tst::write("parameters.txt", "tsave tend / 100\ngenes rep(1.0, ngenes)\nngenes 4\ntend 1000\neffects -genes * 2 ^ 2 + (1 - 0.5)\ntotal sum(effects)");
+
+    // Compile it
+    ParGraph graph;
+    graph.load("parameters.txt");
+
+    // Check the order of evaluation
+    BOOST_CHECK_EQUAL(graph.size(), 6u);
+    BOOST_CHECK_EQUAL(graph.getname(graph.getorder()[0u]), "tend");
+
+    // Evaluate it
+    ParSet pars = graph.evaluate();
+
+    // Read values
+    int tsave;
+    double total;
+    std::vector<double> genes, effects;
+    pars.getvalue<int>("tsave", tsave);
+    pars.getvalue<double>("total", total);
+    pars.getvalues<double>("genes", genes, 4u);
+    pars.getvalues<double>("effects", effects, 4u);
+
+    // Check
+    BOOST_CHECK_EQUAL(tsave, 10);
+    BOOST_CHECK_EQUAL(genes[3u], 1.0);
+    BOOST_CHECK_EQUAL(effects[0u], -3.5);
+    BOOST_CHECK_EQUAL(total, -14.0);
+
+    // Lines are kept for error messages
+    tst::checkError([&]() { pars.getvalues<double>("genes", genes, 3u); }, "Too many values for parameter genes in line 2 of file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test errors in expressions
+BOOST_AUTO_TEST_CASE(graphErrors) {
+
+    // Prepare
+    ParGraph graph;
+
+    // Cycle
+    tst::write("parameters.txt", "a b + 1\nb c * 2\nc a");
+    tst::checkError([&]() { graph.load("parameters.txt"); }, "Circular definition of parameter a in line 1 of file parameters.txt");
+
+    // Unknown parameter
+    tst::write("parameters.txt", "a b + 1");
+    tst::checkError([&]() { graph.load("parameters.txt"); }, "Unknown parameter b in expression for parameter a in line 1 of file parameters.txt");
+
+    // Syntax error
+    tst::write("parameters.txt", "b 1\na (b + 1");
+    tst::checkError([&]() { graph.load("parameters.txt"); }, "Invalid expression for parameter a in line 2 of file parameters.txt");
+
+    // Unknown function
+    tst::write("parameters.txt", "b 1\na foo(b)");
+    tst::checkError([&]() { graph.load("parameters.txt"); }, "Invalid expression for parameter a in line 2 of file parameters.txt");
+
+    // Vectors of different lengths
+    tst::write("parameters.txt", "b 1 2\nc 1 2 3\na b + c");
+    graph.load("parameters.txt");
+    tst::checkError([&]() { graph.evaluate(); }, "Invalid expression for parameter a in line 3 of file parameters.txt");
+
+    // Division by zero
+    tst::write("parameters.txt", "b 0\na 1 / b");
+    graph.load("parameters.txt");
+    tst::checkError([&]() { graph.evaluate(); }, "Invalid expression for parameter a in line 2 of file parameters.txt");
+
+    // Too many repeats
+    tst::write("parameters.txt", "b 1 2\na rep(b, 1e15)");
+    graph.load("parameters.txt");
+    tst::checkError([&]() { graph.evaluate(); }, "Invalid expression for parameter a in line 2 of file parameters.txt");
+
+    // Repeats that would overflow once multiplied by the number of values
+    tst::write("parameters.txt", "b 1 2 3\na rep(b, 1e19)");
+    graph.load("parameters.txt");
+    tst::checkError([&]() { graph.evaluate(); }, "Invalid expression for parameter a in line 2 of file parameters.txt");
+
+    // Numbers too large to be stored
+    tst::write("parameters.txt", "tend 1e+400\ntsave tend / 100");
+    tst::checkError([&]() { graph.load("parameters.txt"); }, "Invalid expression for parameter tend in line 1 of file parameters.txt");
+    tst::write("parameters.txt", "tend 100\ntsave tend / 1e+400");
+    tst::checkError([&]() { graph.load("parameters.txt"); }, "Invalid expression for parameter tsave in line 2 of file parameters.txt");
+
+    // Repeats that are not whole numbers
+    tst::write("parameters.txt", "a rep(1, 2.5)");
+    graph.load("parameters.txt");
+    tst::checkError([&]() { graph.evaluate(); }, "Invalid expression for parameter a in line 1 of file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
@@ -0,0 +1,148 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test layered parameter overrides
+
+#include "testutils.hpp"
+#include "../src/parlayers.hpp"
+#include "../src/fingerprint.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cstdlib>
+
+// Test that override files take precedence over the base
+BOOST_AUTO_TEST_CASE(layersOverrideFile) {
+
+    // Write parameter files
+    tst::write("base.txt", "ngenes 4\nmutrate 0.01\ngenes 1 2 3 4");
+    tst::write("override.txt", "mutrate 0.02");
+
+    // Load the base
+    ParSet base;
+    base.load("base.txt");
+
+    // Stack the override on top
+    ParLayers pars(base);
+    pars.addfile("override.txt");
+
+    // Read values
+    int ngenes;
+    double mutrate;
+    pars.getvalue<int>("ngenes", ngenes);
+    pars.getvalue<double>("mutrate", mutrate);
+
+    // Check
+    BOOST_CHECK_EQUAL(pars.size(), 2u);
+    BOOST_CHECK_EQUAL(ngenes, 4);
+    BOOST_CHECK_EQUAL(mutrate, 0.02);
+    BOOST_CHECK_EQUAL(pars.where("mutrate"), 1u);
+    BOOST_CHECK_EQUAL(pars.where("ngenes"), 0u);
+
+    // The base is shared, not copied
+    BOOST_CHECK_EQUAL(pars.getlayer(0u).data(), base.data());
+
+    // Missing parameters give the usual error
+    tst::checkError([&]() { pars.getvalue<double>("noise", mutrate); }, "Missing parameter noise in file base.txt");
+
+    // Remove the files
+    std::remove("base.txt");
+    std::remove("override.txt");
+
+}
+
+// Test overrides from the command line
+BOOST_AUTO_TEST_CASE(layersCommandLine) {
+
+    // Write a parameter file
+    tst::write("base.txt", "ngenes 4\nmutrate 0.01\ngenes 1 2 3 4");
+
+    // Load the base
+    ParSet base;
+    base.load("base.txt");
+
+    // Arguments
+    const char* argv[] = { "program", "mutrate=0.05", "genes=4,3,2,1" };
+
+    // Stack them on top
+    ParLayers pars(base);
+    pars.addargs(3, argv);
+
+    // Read values
+    double mutrate;
+    std::vector<double> genes;
+    std::vector<int> genes2;
+    pars.getvalue<double>("mutrate", mutrate);
+    pars.getvalues<double>("genes", genes, 4u);
+
+    // Check
+    BOOST_CHECK_EQUAL(mutrate, 0.05);
+    BOOST_CHECK_EQUAL(genes[0u], 4.0);
+
+    // Merging the layers gives the same as writing the file by hand
+    tst::write("merged.txt", "ngenes 4\nmutrate 0.05\ngenes 4 3 2 1");
+    ParSet merged;
+    merged.load("merged.txt");
+    BOOST_CHECK(fingerprint(pars.flatten()) == fingerprint(merged));
+
+    // Values failing a check are reported in the argument they come from
+    tst::checkError([&]() { pars.getvalue<double>("mutrate", mutrate, [](const double &x) { return x < 0.01 ? "" : "must be below 0.01"; }); }, "Parameter mutrate must be below 0.01 in argument 1");
+    tst::checkError([&]() { pars.flatten().getvalues<int>("genes", genes2, 3u); }, "Too many values for parameter genes in argument 2");
+
+    // Check errors
+    const char* bad1[] = { "program", "mutrate" };
+    const char* bad2[] = { "program", "mutrate=abc" };
+    const char* bad3[] = { "program", "mutrate=" };
+    tst::checkError([&]() { pars.addargs(2, bad1); }, "Invalid assignment mutrate in argument 1");
+    tst::checkError([&]() { pars.addargs(2, bad2); }, "Invalid value type for parameter mutrate in argument 1");
+    tst::checkError([&]() { pars.addargs(2, bad3); }, "No value for parameter mutrate in argument 1");
+
+    // Remove the files
+    std::remove("base.txt");
+    std::remove("merged.txt");
+
+}
+
+#ifndef _WIN32
+
+// Test overrides from environment variables
+BOOST_AUTO_TEST_CASE(layersEnvironment) {
+
+    // Write a parameter file
+    tst::write("base.txt", "ngenes 4\nmutrate 0.01");
+
+    // Load the base
+    ParSet base;
+    base.load("base.txt");
+
+    // Set a variable
+    setenv("READPARSTEST_mutrate", "0.03", 1);
+
+    // Stack the environment on top
+    ParLayers pars(base);
+    pars.addenv("READPARSTEST_");
+
+    // Read value
+    double mutrate;
+    pars.getvalue<double>("mutrate", mutrate);
+
+    // Check
+    BOOST_CHECK_EQUAL(mutrate, 0.03);
+    BOOST_CHECK_EQUAL(pars.getlayer(1u).size(), 1u);
+
+    // Values failing a check are reported in the variable they come from
+    const std::string error = "Parameter mutrate must be below 0.01 in variable READPARSTEST_mutrate";
+    auto check = [](const double &x) { return x < 0.01 ? "" : "must be below 0.01"; };
+    tst::checkError([&]() { pars.getvalue<double>("mutrate", mutrate, check); }, error);
+    tst::checkError([&]() { pars.flatten().getvalue<double>("mutrate", mutrate, check); }, error);
+
+    // As are invalid assignments
+    setenv("READPARSTEST_ngenes", "abc", 1);
+    tst::checkError([&]() { pars.addenv("READPARSTEST_"); }, "Invalid value type for parameter ngenes in variable READPARSTEST_ngenes");
+    unsetenv("READPARSTEST_ngenes");
+
+    // Clean up
+    unsetenv("READPARSTEST_mutrate");
+    std::remove("base.txt");
+
+}
+
+#endif
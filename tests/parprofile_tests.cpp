@@ -0,0 +1,128 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the per-parameter profile recorded by the reader
+
+#include "testutils.hpp"
+#include "../src/readpars.hpp"
+#include "../src/parprofile.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+
+// Test that values and times are recorded for each parameter
+BOOST_AUTO_TEST_CASE(profileEntries) {
+
+    // Write a file
+    const std::string text = "# Parameters\n\npopsize 10\nmutrate 0.01\ntraits 1 2 3\n";
+    tst::write("parameters.txt", text);
+
+    // Create a reader with a profile
+    ParProfile profile;
+    ReadPars reader("parameters.txt");
+    reader.setprofile(profile);
+    reader.open();
+
+    // Prepare to read parameters
+    int popsize;
+    double mutrate;
+    std::vector<size_t> traits;
+
+    // Slow check on the vector
+    auto slow = [](const std::vector<size_t> &x) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return x.size() == 3u ? "" : "must have three values";
+    };
+
+    // Read them
+    while (!reader.iseof()) {
+        reader.readline();
+        if (reader.isempty() || reader.iscomment()) continue;
+        const std::string par = reader.getname();
+        if (par == "popsize") reader.readvalue<int>(popsize);
+        else if (par == "mutrate") reader.readvalue<double>(mutrate, [](const double &x) { return x < 1.0 ? "" : "must be below one"; });
+        else reader.readvalues<size_t>(traits, 3u, nullptr, slow);
+    }
+    reader.close();
+
+    // Check the entries (in order of appearance)
+    const std::deque<ParProfile::Entry> &entries = profile.getentries();
+    BOOST_CHECK_EQUAL(profile.size(), 3u);
+    BOOST_CHECK_EQUAL(entries[0u].name, "popsize");
+    BOOST_CHECK_EQUAL(entries[1u].name, "mutrate");
+    BOOST_CHECK_EQUAL(entries[2u].name, "traits");
+    BOOST_CHECK_EQUAL(entries[0u].lines, 1u);
+    BOOST_CHECK_EQUAL(entries[0u].values, 1u);
+    BOOST_CHECK_EQUAL(entries[2u].values, 3u);
+
+    // Check the times
+    BOOST_CHECK(entries[0u].convert > 0.0);
+    BOOST_CHECK_EQUAL(entries[0u].check, 0.0);
+    BOOST_CHECK(entries[1u].check > 0.0);
+    BOOST_CHECK(entries[2u].check >= 0.005);
+
+    // The slow check comes first when sorted
+    BOOST_CHECK_EQUAL(profile.getsorted()[0u].name, "traits");
+
+    // The same profile adds up over readers
+    ReadPars other("parameters.txt");
+    other.setprofile(profile);
+    other.open("popsize 20\nselection 1\n");
+    other.readline();
+    other.readvalue<int>(popsize);
+    other.readline();
+    BOOST_CHECK_EQUAL(profile.size(), 4u);
+    BOOST_CHECK_EQUAL(entries[0u].lines, 2u);
+    BOOST_CHECK_EQUAL(entries[0u].values, 2u);
+    BOOST_CHECK_EQUAL(entries[3u].name, "selection");
+    BOOST_CHECK_EQUAL(entries[3u].values, 0u);
+
+    // And can be cleared
+    profile.clear();
+    BOOST_CHECK_EQUAL(profile.size(), 0u);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that readers without a profile record nothing
+BOOST_AUTO_TEST_CASE(profileDisabled) {
+
+    // Profile given to no reader
+    ParProfile profile;
+
+    // Read without it
+    ReadPars reader("parameters.txt");
+    reader.open("popsize 10\n");
+    reader.readline();
+    int popsize;
+    reader.readvalue<int>(popsize, [](const int &x) { return x > 0 ? "" : "must be positive"; });
+
+    // Check
+    BOOST_CHECK_EQUAL(popsize, 10);
+    BOOST_CHECK_EQUAL(profile.size(), 0u);
+
+}
+
+// Test that the profile can be written as JSON
+BOOST_AUTO_TEST_CASE(profileJson) {
+
+    // Profile
+    ParProfile profile;
+    ParProfile::Entry &popsize = profile.getentry("popsize");
+    popsize.lines = 1u;
+    popsize.values = 1u;
+    popsize.convert = 0.25;
+    ParProfile::Entry &traits = profile.getentry("traits");
+    traits.lines = 1u;
+    traits.values = 3u;
+    traits.check = 0.5;
+
+    // Check (most costly first)
+    BOOST_CHECK_EQUAL(profile.tojson(),
+        "{\"traits\": {\"lines\": 1, \"values\": 3, \"convert\": 0, \"check\": 0.5, \"total\": 0.5}, "
+        "\"popsize\": {\"lines\": 1, \"values\": 1, \"convert\": 0.25, \"check\": 0, \"total\": 0.25}}"
+    );
+
+}
@@ -0,0 +1,367 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test parsed parameter sets and their snapshots
+
+#include "testutils.hpp"
+#include "../src/parset.hpp"
+#include "../src/parcache.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <cstring>
+
+// Test that a whole file can be loaded into a set
+BOOST_AUTO_TEST_CASE(parsetLoad) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "# Comment\nngenes 4\n\nmutrate 0.01\ngenes 1.0 1.2 3.5 2.0");
+
+    // Load it
+    ParSet pars;
+    pars.load("parameters.txt");
+
+    // Check elements
+    BOOST_CHECK_EQUAL(pars.size(), 3u);
+    BOOST_CHECK_EQUAL(pars.getfilename(), "parameters.txt");
+    BOOST_CHECK_EQUAL(pars.getname(0u), "ngenes");
+    BOOST_CHECK_EQUAL(pars.getline(1u), 4u);
+    BOOST_CHECK_EQUAL(pars.getcount(2u), 4u);
+    BOOST_CHECK(pars.has("mutrate"));
+    BOOST_CHECK(!pars.has("noise"));
+
+    // Read values
+    int ngenes;
+    double mutrate;
+    std::vector<double> genes;
+    pars.getvalue<int>("ngenes", ngenes);
+    pars.getvalue<double>("mutrate", mutrate);
+    pars.getvalues<double>("genes", genes, 4u);
+
+    // Check
+    BOOST_CHECK_EQUAL(ngenes, 4);
+    BOOST_CHECK_EQUAL(mutrate, 0.01);
+    BOOST_CHECK_EQUAL(genes[2u], 3.5);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that the last occurrence of a parameter wins
+BOOST_AUTO_TEST_CASE(parsetLastOccurrence) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "popsize 10\nnloci 3\npopsize 20");
+
+    // Load it
+    ParSet pars;
+    pars.load("parameters.txt");
+
+    // Read value
+    size_t popsize;
+    pars.getvalue<size_t>("popsize", popsize);
+
+    // Check
+    BOOST_CHECK_EQUAL(popsize, 20u);
+    BOOST_CHECK_EQUAL(pars.find("popsize"), 2u);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Function to check that a number is strictly positive
+std::string checkstrictpos(const size_t &x) { return x > 0u ? "" : "must be strictly positive"; }
+
+// Test the errors of a set
+BOOST_AUTO_TEST_CASE(parsetErrors) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "nloci -1\npopsize 0\ngenes 1 2 3");
+
+    // Load it
+    ParSet pars;
+    pars.load("parameters.txt");
+
+    // Containers
+    size_t x;
+    std::vector<size_t> v;
+
+    // Check errors
+    tst::checkError([&]() { pars.getvalue<size_t>("nloci", x); }, "Invalid value type for parameter nloci in line 1 of file parameters.txt");
+    tst::checkError([&]() { pars.getvalue<size_t>("popsize", x, checkstrictpos); }, "Parameter popsize must be strictly positive in line 2 of file parameters.txt");
+    tst::checkError([&]() { pars.getvalue<size_t>("genes", x); }, "Too many values for parameter genes in line 3 of file parameters.txt");
+    tst::checkError([&]() { pars.getvalues<size_t>("genes", v, 4u); }, "Too few values for parameter genes in line 3 of file parameters.txt");
+    tst::checkError([&]() { pars.getvalue<size_t>("noise", x); }, "Missing parameter noise in file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that whole numbers are stored and read back exactly
+BOOST_AUTO_TEST_CASE(parsetLoadIntegers) {
+
+    // Write a parameter file with integers too large for doubles
+    tst::write("parameters.txt", "seed 9007199254740993\nbig 9223372036854775807\nhuge 18446744073709551615\nlow -9223372036854775808\nmixed 1 2.5\nsigns -1 18446744073709551615\nngenes 4");
+
+    // Load it
+    ParSet pars;
+    pars.load("parameters.txt");
+
+    // Check the stored types
+    BOOST_CHECK_EQUAL(pars.gettype(pars.find("seed")), ParSet::Integer);
+    BOOST_CHECK_EQUAL(pars.gettype(pars.find("huge")), ParSet::Unsigned);
+    BOOST_CHECK_EQUAL(pars.gettype(pars.find("mixed")), ParSet::Double);
+    BOOST_CHECK_EQUAL(pars.gettype(pars.find("signs")), ParSet::Double);
+
+    // Save and map it back
+    pars.save("parameters.bin");
+    ParSet copy;
+    copy.map("parameters.bin");
+
+    // Values are read back as from the file
+    for (const ParSet *set : { &pars, &copy }) {
+
+        long long seed, big, low;
+        unsigned long long huge;
+        set->getvalue<long long>("seed", seed);
+        set->getvalue<long long>("big", big);
+        set->getvalue<long long>("low", low);
+        set->getvalue<unsigned long long>("huge", huge);
+        BOOST_CHECK_EQUAL(seed, 9007199254740993ll);
+        BOOST_CHECK_EQUAL(big, std::numeric_limits<long long>::max());
+        BOOST_CHECK_EQUAL(low, std::numeric_limits<long long>::min());
+        BOOST_CHECK_EQUAL(huge, std::numeric_limits<unsigned long long>::max());
+
+    }
+
+    // As are smaller integers, into any type that holds them
+    double x;
+    unsigned short n;
+    pars.getvalue<double>("ngenes", x);
+    pars.getvalue<unsigned short>("ngenes", n);
+    BOOST_CHECK_EQUAL(x, 4.0);
+    BOOST_CHECK_EQUAL(n, 4u);
+
+    // But not into types too small for them
+    int y;
+    tst::checkError([&]() { pars.getvalue<int>("big", y); }, "Invalid value type for parameter big in line 2 of file parameters.txt");
+    tst::checkError([&]() { pars.getvalue<int>("huge", y); }, "Invalid value type for parameter huge in line 3 of file parameters.txt");
+
+    // Remove the files
+    std::remove("parameters.txt");
+    std::remove("parameters.bin");
+
+}
+
+// Test that a snapshot can be adopted as raw bytes
+BOOST_AUTO_TEST_CASE(parsetSnapshot) {
+
+    // Build a set by hand
+    ParBuilder builder("custom");
+    builder.add("b", { 1.0, 2.0 }, 1u);
+    builder.add("a", { 3.0 }, 2u);
+    ParSet original = builder.build();
+
+    // Copy its raw bytes
+    std::vector<char> bytes(original.data(), original.data() + original.bytes());
+
+    // Adopt them
+    ParSet copy(std::move(bytes));
+
+    // Check
+    BOOST_CHECK_EQUAL(copy.size(), 2u);
+    BOOST_CHECK_EQUAL(copy.getfilename(), "custom");
+    BOOST_CHECK_EQUAL(copy.find("a"), 1u);
+    BOOST_CHECK_EQUAL(copy.getview<double>("b")[1u], 2.0);
+
+    // Corrupted snapshots are rejected
+    tst::checkError([&]() { ParSet(std::vector<char>(10u, 'x')); }, "Invalid parameter snapshot");
+
+}
+
+// Test that snapshots breaking the layout are rejected
+BOOST_AUTO_TEST_CASE(parsetSnapshotLayout) {
+
+    // Build a set by hand
+    ParBuilder builder("custom");
+    builder.add<bool>("b", { true, false });
+    builder.add("a", { 3.0 });
+    ParSet original = builder.build();
+
+    // Raw bytes
+    const std::vector<char> bytes(original.data(), original.data() + original.bytes());
+
+    // Position of the index (after the magic, version, number of entries
+    // and file name)
+    uint64_t offset;
+    std::memcpy(&offset, bytes.data() + 32u, sizeof offset);
+
+    // An index that is not sorted by name is rejected
+    std::vector<char> unsorted = bytes;
+    std::swap_ranges(unsorted.data() + offset, unsorted.data() + offset + 8u, unsorted.data() + offset + 8u);
+    tst::checkError([&]() { ParSet(std::move(unsorted)); }, "Invalid parameter snapshot");
+
+    // So is a Boolean value that is neither zero nor one
+    std::vector<char> boolean = bytes;
+    boolean[original.getblock(0u) - original.data() + 1u] = 2;
+    tst::checkError([&]() { ParSet(std::move(boolean)); }, "Invalid parameter snapshot");
+
+    // While the original bytes are fine
+    std::vector<char> valid = bytes;
+    ParSet copy(std::move(valid));
+    BOOST_CHECK_EQUAL(copy.getview<bool>("b")[0u], true);
+
+}
+
+// Test conversion into a typed binary file and memory-mapped reading
+BOOST_AUTO_TEST_CASE(parsetBinaryFile) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "ngenes 4\nmutrate 0.01\nverbose 1\ngenes 1.0 1.2 3.5 2.0");
+
+    // Open it
+    ReadPars reader("parameters.txt");
+    reader.open();
+
+    // Convert it line by line, with checks
+    ParBuilder builder("parameters.txt");
+    while (!reader.iseof()) {
+        reader.readline();
+        const std::string name = reader.getname();
+        if (name == "ngenes") builder.readvalue<int>(reader);
+        else if (name == "mutrate") builder.readvalue<double>(reader);
+        else if (name == "verbose") builder.readvalue<bool>(reader);
+        else if (name == "genes") builder.readvalues<double>(reader, 4u);
+    }
+
+    // Save in binary format
+    builder.build().save("parameters.bin");
+
+    // Map it back
+    ParSet pars;
+    pars.map("parameters.bin");
+
+    // Check types
+    BOOST_CHECK_EQUAL(pars.gettype(0u), ParSet::Integer);
+    BOOST_CHECK_EQUAL(pars.gettype(2u), ParSet::Boolean);
+
+    // Check typed views
+    BOOST_CHECK_EQUAL(pars.getview<int64_t>("ngenes")[0u], 4);
+    BOOST_CHECK_EQUAL(pars.getview<bool>("verbose")[0u], true);
+    BOOST_CHECK_EQUAL(pars.getview<double>("genes").size(), 4u);
+    BOOST_CHECK_EQUAL(pars.getview<double>("genes")[2u], 3.5);
+
+    // Values can still be converted into other types
+    size_t ngenes;
+    pars.getvalue<size_t>("ngenes", ngenes);
+    BOOST_CHECK_EQUAL(ngenes, 4u);
+
+    // But views must match the stored type
+    tst::checkError([&]() { pars.getview<double>("ngenes"); }, "Invalid value type for parameter ngenes in line 1 of file parameters.txt");
+
+    // Remove the files
+    std::remove("parameters.txt");
+    std::remove("parameters.bin");
+
+}
+
+// Test that invalid binary files are rejected
+BOOST_AUTO_TEST_CASE(parsetBinaryFileErrors) {
+
+    // Write a text file
+    tst::write("parameters.txt", "ngenes 4");
+
+    // Check errors
+    ParSet pars;
+    tst::checkError([&]() { pars.map("nonexistent.bin"); }, "Unable to open file nonexistent.bin");
+    tst::checkError([&]() { pars.map("parameters.txt"); }, "Invalid parameter snapshot");
+
+    // Failing to write is reported
+    pars.load("parameters.txt");
+    tst::checkError([&]() { pars.save("nonexistent/parameters.bin"); }, "Unable to open file nonexistent/parameters.bin");
+#ifdef __linux__
+    tst::checkError([&]() { pars.save("/dev/full"); }, "Unable to write file /dev/full");
+#endif
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test include directives
+BOOST_AUTO_TEST_CASE(parsetIncludeFiles) {
+
+    // Write a base file and two files including it
+    tst::write("common.txt", "ngenes 4\nmutrate 0.01\ngenes 1 2 3 4");
+    tst::write("model1.txt", "include common.txt\nmutrate 0.02");
+    tst::write("model2.txt", "popsize 100\ninclude common.txt");
+
+    // Start from an empty cache
+    ParCache::global().clear();
+
+    // Load both
+    ParSet pars1, pars2;
+    pars1.load("model1.txt");
+    pars2.load("model2.txt");
+
+    // Read values
+    int ngenes;
+    double mutrate;
+    pars1.getvalue<int>("ngenes", ngenes);
+    pars1.getvalue<double>("mutrate", mutrate);
+
+    // Check that later lines override included ones
+    BOOST_CHECK_EQUAL(ngenes, 4);
+    BOOST_CHECK_EQUAL(mutrate, 0.02);
+    BOOST_CHECK_EQUAL(pars2.size(), 4u);
+
+    // Included parameters point to the include directive
+    BOOST_CHECK_EQUAL(pars2.getline(pars2.find("genes")), 2u);
+
+    // The base was parsed only once
+    BOOST_CHECK_EQUAL(ParCache::global().getmisses(), 1u);
+    BOOST_CHECK_EQUAL(ParCache::global().gethits(), 1u);
+
+    // Remove the files
+    std::remove("common.txt");
+    std::remove("model1.txt");
+    std::remove("model2.txt");
+
+}
+
+// Test errors in include directives
+BOOST_AUTO_TEST_CASE(parsetIncludeErrors) {
+
+    // Prepare
+    ParSet pars;
+
+    // Files including each other
+    tst::write("model1.txt", "ngenes 4\ninclude model2.txt");
+    tst::write("model2.txt", "include model1.txt");
+    tst::checkError([&]() { pars.load("model1.txt"); }, "Circular inclusion of file model1.txt in line 1 of file model2.txt");
+
+    // A file including itself
+    tst::write("model1.txt", "include model1.txt");
+    tst::checkError([&]() { pars.load("model1.txt"); }, "Circular inclusion of file model1.txt in line 1 of file model1.txt");
+
+    // Missing file
+    tst::write("model1.txt", "include nonexistent.txt");
+    tst::checkError([&]() { pars.load("model1.txt"); }, "Unable to open file nonexistent.txt");
+
+    // Too many files
+    tst::write("model1.txt", "include a.txt b.txt");
+    tst::checkError([&]() { pars.load("model1.txt"); }, "Too many values for parameter include in line 1 of file model1.txt");
+
+    // Invalid file name
+    tst::write("model1.txt", "include a*.txt");
+    tst::checkError([&]() { pars.load("model1.txt"); }, "Could not read value for parameter include in line 1 of file model1.txt");
+
+    // Remove the files
+    std::remove("model1.txt");
+    std::remove("model2.txt");
+
+}
@@ -0,0 +1,156 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the statistics recorded by the reader
+
+#include "testutils.hpp"
+#include "../src/readpars.hpp"
+#include "../src/parstats.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test that the amounts read are counted
+BOOST_AUTO_TEST_CASE(statsCounts) {
+
+    // Write a file
+    const std::string text = "# Parameters\n\npopsize 10\nmutrate 0.01\nverbose 1\nname abc\ntraits 1 2 3\n";
+    tst::write("parameters.txt", text);
+
+    // Create a reader with statistics
+    ParStats stats;
+    ReadPars reader("parameters.txt");
+    reader.setstats(stats);
+    reader.open();
+
+    // Prepare to read parameters
+    int popsize;
+    double mutrate;
+    bool verbose;
+    std::string name;
+    std::vector<size_t> traits;
+
+    // Read them
+    while (!reader.iseof()) {
+        reader.readline();
+        if (reader.isempty() || reader.iscomment()) continue;
+        const std::string par = reader.getname();
+        if (par == "popsize") reader.readvalue<int>(popsize);
+        else if (par == "mutrate") reader.readvalue<double>(mutrate, [](const double &x) { return x < 1.0 ? "" : "must be below one"; });
+        else if (par == "verbose") reader.readvalue<bool>(verbose);
+        else if (par == "name") reader.readvalue<std::string>(name);
+        else reader.readvalues<size_t>(traits, 3u, nullptr, [](const std::vector<size_t> &x) { return x.size() == 3u ? "" : "must have three values"; });
+    }
+    reader.close();
+
+    // Check the amounts
+    BOOST_CHECK_EQUAL(stats.bytes, text.size());
+    BOOST_CHECK_EQUAL(stats.lines, 7u);
+    BOOST_CHECK_EQUAL(stats.tokens, 12u);
+    BOOST_CHECK_EQUAL(stats.errors, 0u);
+    BOOST_CHECK_EQUAL(stats.booleans, 1u);
+    BOOST_CHECK_EQUAL(stats.integers, 4u);
+    BOOST_CHECK_EQUAL(stats.reals, 1u);
+    BOOST_CHECK_EQUAL(stats.strings, 1u);
+
+    // Check the times
+    BOOST_CHECK(stats.io > 0.0);
+    BOOST_CHECK(stats.split > 0.0);
+    BOOST_CHECK(stats.convert > 0.0);
+    BOOST_CHECK(stats.check > 0.0);
+    BOOST_CHECK_EQUAL(stats.error, 0.0);
+    BOOST_CHECK_CLOSE(stats.total(), stats.io + stats.split + stats.validate + stats.convert + stats.check, 1e-9);
+
+    // The same statistics add up over readers
+    ReadPars other("parameters.txt");
+    other.setstats(stats);
+    other.open(text);
+    while (!other.iseof()) other.readline();
+    BOOST_CHECK_EQUAL(stats.bytes, 2u * text.size());
+    BOOST_CHECK_EQUAL(stats.lines, 14u);
+
+    // And can be cleared
+    stats.clear();
+    BOOST_CHECK_EQUAL(stats.lines, 0u);
+    BOOST_CHECK_EQUAL(stats.total(), 0.0);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that errors are counted, whatever their origin
+BOOST_AUTO_TEST_CASE(statsErrors) {
+
+    // Statistics
+    ParStats stats;
+
+    // Missing file
+    ReadPars missing("nonexistent.txt");
+    missing.setstats(stats);
+    tst::checkError([&]() { missing.open(); }, "Unable to open file nonexistent.txt");
+
+    // Invalid value
+    ReadPars invalid("parameters.txt");
+    invalid.setstats(stats);
+    invalid.open("popsize 1.5\n");
+    invalid.readline();
+    int popsize;
+    tst::checkError([&]() { invalid.readvalue<int>(popsize); }, "Invalid value type for parameter popsize in line 1 of file parameters.txt");
+
+    // Failed check
+    ReadPars checked("parameters.txt");
+    checked.setstats(stats);
+    checked.open("popsize -1\n");
+    checked.readline();
+    tst::checkError([&]() { checked.readvalue<int>(popsize, [](const int &x) { return x > 0 ? "" : "must be positive"; }); }, "Parameter popsize must be positive in line 1 of file parameters.txt");
+
+    // Unknown parameter
+    ReadPars unknown("parameters.txt");
+    unknown.setstats(stats);
+    unknown.open("foo 1\n");
+    unknown.readline();
+    tst::checkError([&]() { unknown.readerror(); }, "Invalid parameter: foo in line 1 of file parameters.txt");
+
+    // Check
+    BOOST_CHECK_EQUAL(stats.errors, 4u);
+    BOOST_CHECK(stats.error > 0.0);
+
+}
+
+// Test that readers without statistics record nothing
+BOOST_AUTO_TEST_CASE(statsDisabled) {
+
+    // Statistics given to no reader
+    ParStats stats;
+
+    // Read without them
+    ReadPars reader("parameters.txt");
+    reader.open("popsize 10\n");
+    reader.readline();
+    int popsize;
+    reader.readvalue<int>(popsize);
+
+    // Check
+    BOOST_CHECK_EQUAL(popsize, 10);
+    BOOST_CHECK_EQUAL(stats.lines, 0u);
+    BOOST_CHECK_EQUAL(stats.total(), 0.0);
+
+}
+
+// Test that statistics can be written as JSON
+BOOST_AUTO_TEST_CASE(statsJson) {
+
+    // Statistics
+    ParStats stats;
+    stats.io = 0.5;
+    stats.convert = 0.25;
+    stats.lines = 3u;
+    stats.reals = 2u;
+
+    // Check
+    BOOST_CHECK_EQUAL(stats.tojson(),
+        "{\"io\": 0.5, \"split\": 0, \"validate\": 0, \"convert\": 0.25, \"check\": 0, \"error\": 0, \"total\": 0.75, "
+        "\"bytes\": 0, \"lines\": 3, \"tokens\": 0, \"errors\": 0, "
+        "\"booleans\": 0, \"integers\": 0, \"reals\": 2, \"strings\": 0}"
+    );
+
+}
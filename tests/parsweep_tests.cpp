@@ -0,0 +1,180 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test parameter sweeps
+
+#include "testutils.hpp"
+#include "../src/parsweep.hpp"
+#include "../src/parcache.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test the Cartesian product of sweeps and ranges
+BOOST_AUTO_TEST_CASE(sweepCartesian) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "ngenes 4\nmutrate sweep 0.001 0.01 0.1\npopsize range 100 1000 100");
+
+    // Load the design
+    ParSweep sweep;
+    sweep.load("parameters.txt");
+
+    // Check the size of the design
+    BOOST_CHECK_EQUAL(sweep.getndims(), 2u);
+    BOOST_CHECK_EQUAL(sweep.size(), 30u);
+    BOOST_CHECK_EQUAL(sweep.getbase().size(), 1u);
+
+    // Pick a point (the last dimension varies fastest)
+    ParLayers point = sweep.getpoint(13u);
+
+    // Read values
+    int ngenes;
+    double mutrate;
+    int popsize;
+    point.getvalue<int>("ngenes", ngenes);
+    point.getvalue<double>("mutrate", mutrate);
+    point.getvalue<int>("popsize", popsize);
+
+    // Check
+    BOOST_CHECK_EQUAL(ngenes, 4);
+    BOOST_CHECK_EQUAL(mutrate, 0.01);
+    BOOST_CHECK_EQUAL(popsize, 400);
+
+    // Both ends of the range are included
+    sweep.getpoint(29u).getvalue<int>("popsize", popsize);
+    BOOST_CHECK_EQUAL(popsize, 1000);
+
+    // Errors point to the original line
+    tst::checkError([&]() { point.getvalue<int>("mutrate", popsize); }, "Invalid value type for parameter mutrate in line 2 of file parameters.txt");
+
+    // Out of range
+    tst::checkError([&]() { sweep.getpoint(30u); }, "Invalid point 30 in sweep of file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that zipped parameters advance together
+BOOST_AUTO_TEST_CASE(sweepZipped) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "seed zip 1 2 3\nmutrate zip 0.1 0.2 0.3\nsex sweep 0 1");
+
+    // Load the design
+    ParSweep sweep;
+    sweep.load("parameters.txt");
+
+    // Check
+    BOOST_CHECK_EQUAL(sweep.getndims(), 2u);
+    BOOST_CHECK_EQUAL(sweep.size(), 6u);
+
+    // Pick a point (the zipped dimension comes last)
+    ParLayers point = sweep.getpoint(4u);
+
+    // Read values
+    int seed;
+    double mutrate;
+    bool sex;
+    point.getvalue<int>("seed", seed);
+    point.getvalue<double>("mutrate", mutrate);
+    point.getvalue<bool>("sex", sex);
+
+    // Check
+    BOOST_CHECK_EQUAL(seed, 2);
+    BOOST_CHECK_EQUAL(mutrate, 0.2);
+    BOOST_CHECK(sex);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test errors in sweep declarations
+BOOST_AUTO_TEST_CASE(sweepErrors) {
+
+    // Prepare
+    ParSweep sweep;
+
+    // Mismatched zip
+    tst::write("parameters.txt", "seed zip 1 2 3\nmutrate zip 0.1 0.2");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Wrong number of zipped values for parameter mutrate in line 2 of file parameters.txt");
+
+    // Bad range
+    tst::write("parameters.txt", "popsize range 100 1000 0");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Invalid sweep for parameter popsize in line 1 of file parameters.txt");
+
+    // Range too long to count
+    tst::write("parameters.txt", "popsize range 0 1e300 1e-300");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Invalid sweep for parameter popsize in line 1 of file parameters.txt");
+
+    // Range whose span overflows
+    tst::write("parameters.txt", "popsize range -1e308 1e308 1");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Invalid sweep for parameter popsize in line 1 of file parameters.txt");
+
+    // Empty sweep
+    tst::write("parameters.txt", "mutrate sweep");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Invalid sweep for parameter mutrate in line 1 of file parameters.txt");
+
+    // Bad value
+    tst::write("parameters.txt", "mutrate sweep 0.1 abc");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Invalid value type for parameter mutrate in line 1 of file parameters.txt");
+
+    // Parameter swept twice
+    tst::write("parameters.txt", "mutrate sweep 0.1 0.2\nmutrate range 0.1 0.5 0.1");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Duplicate sweep for parameter mutrate in line 2 of file parameters.txt");
+
+    // Parameter both swept and zipped
+    tst::write("parameters.txt", "seed zip 1 2\nseed sweep 1 2");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Duplicate sweep for parameter seed in line 2 of file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that included files go into the fixed parameters
+BOOST_AUTO_TEST_CASE(sweepIncludeFiles) {
+
+    // Write a base file and a sweep including it
+    tst::write("common.txt", "ngenes 4\nmutrate 0.01");
+    tst::write("parameters.txt", "include common.txt\nngenes 8\nmutrate sweep 0.001 0.01 0.1");
+
+    // Start from an empty cache
+    ParCache::global().clear();
+
+    // Load the design
+    ParSweep sweep;
+    sweep.load("parameters.txt");
+
+    // The included parameters are fixed
+    BOOST_CHECK_EQUAL(sweep.getndims(), 1u);
+    BOOST_CHECK_EQUAL(sweep.size(), 3u);
+    BOOST_CHECK_EQUAL(sweep.getbase().size(), 3u);
+
+    // Read values
+    int ngenes;
+    double mutrate;
+    ParLayers point = sweep.getpoint(2u);
+    point.getvalue<int>("ngenes", ngenes);
+    point.getvalue<double>("mutrate", mutrate);
+
+    // Later lines and sweeps override included ones
+    BOOST_CHECK_EQUAL(ngenes, 8);
+    BOOST_CHECK_EQUAL(mutrate, 0.1);
+
+    // The included file went through the cache
+    BOOST_CHECK_EQUAL(ParCache::global().getmisses(), 1u);
+
+    // Files including the sweep back
+    tst::write("common.txt", "include parameters.txt");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Circular inclusion of file parameters.txt in line 1 of file common.txt");
+
+    // A sweep including itself
+    tst::write("parameters.txt", "mutrate sweep 0.1 0.2\ninclude parameters.txt");
+    tst::checkError([&]() { sweep.load("parameters.txt"); }, "Circular inclusion of file parameters.txt in line 2 of file parameters.txt");
+
+    // Remove the files
+    std::remove("common.txt");
+    std::remove("parameters.txt");
+
+}
@@ -0,0 +1,124 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test tables of parameters
+
+#include "testutils.hpp"
+#include "../src/partable.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Function to check that a value is strictly positive
+std::string checkstrictpos(const size_t &x) { return x > 0u ? "" : "must be strictly positive"; }
+
+// Test that a table is read column by column
+BOOST_AUTO_TEST_CASE(tableReadColumns) {
+
+    // Build a table with many rows
+    std::string text = "# Sensitivity analysis\nmutrate popsize seed\n";
+    for (int i = 0; i < 1000; ++i)
+        text += "0.0" + std::to_string(i % 10) + " " + std::to_string(100 * (i + 1)) + " " + std::to_string(i) + "\n";
+
+    // Write it
+    tst::write("table.txt", text);
+
+    // Read it on several threads
+    ParTable table;
+    table.load("table.txt", 4u);
+
+    // Check the shape
+    BOOST_CHECK_EQUAL(table.size(), 1000u);
+    BOOST_CHECK_EQUAL(table.getncols(), 3u);
+    BOOST_CHECK_EQUAL(table.getname(1u), "popsize");
+    BOOST_CHECK_EQUAL(table.getline(0u), 3u);
+
+    // Read whole columns
+    std::vector<double> mutrate;
+    std::vector<size_t> popsize;
+    table.getcolumn<double>("mutrate", mutrate);
+    table.getcolumn<size_t>("popsize", popsize, checkstrictpos);
+
+    // Check
+    BOOST_CHECK_EQUAL(mutrate[13u], 0.03);
+    BOOST_CHECK_EQUAL(popsize[999u], 100000u);
+    BOOST_CHECK_EQUAL(table.getcolumn("seed")[500u], 500.0);
+
+    // Remove the file
+    std::remove("table.txt");
+
+}
+
+// Test tables with Windows line endings
+BOOST_AUTO_TEST_CASE(tableWindowsLineEndings) {
+
+    // Write a table with a blank line and a comment
+    tst::write("table.txt", "# Sweep\r\nmutrate popsize\r\n0.01 100\r\n\r\n0.02 200\r\n");
+
+    // Read it
+    ParTable table;
+    table.load("table.txt");
+
+    // Check
+    BOOST_CHECK_EQUAL(table.size(), 2u);
+    BOOST_CHECK_EQUAL(table.getname(1u), "popsize");
+    BOOST_CHECK_EQUAL(table.getline(1u), 5u);
+    BOOST_CHECK_EQUAL(table.getcolumn("popsize")[1u], 200.0);
+
+    // Remove the file
+    std::remove("table.txt");
+
+}
+
+// Test errors in tables
+BOOST_AUTO_TEST_CASE(tableErrors) {
+
+    // Prepare
+    ParTable table;
+
+    // Wrong number of values
+    tst::write("table.txt", "mutrate popsize\n0.01 100\n0.02");
+    tst::checkError([&]() { table.load("table.txt"); }, "Too few values in line 3 of file table.txt");
+
+    // Invalid value
+    tst::write("table.txt", "mutrate popsize\n0.01 100\n0.02 abc");
+    tst::checkError([&]() { table.load("table.txt"); }, "Invalid value type for parameter popsize in line 3 of file table.txt");
+
+    // Values that do not fit the requested type
+    tst::write("table.txt", "mutrate popsize\n0.01 100\n0.02 -100");
+    table.load("table.txt");
+    std::vector<unsigned> popsize;
+    tst::checkError([&]() { table.getcolumn<unsigned>("popsize", popsize); }, "Invalid value type for parameter popsize in line 3 of file table.txt");
+
+    // Values failing a check
+    std::vector<double> mutrate;
+    tst::checkError([&]() {
+        table.getcolumn<double>("mutrate", mutrate, [](const double &x) { return x < 0.015 ? "must be above 0.015" : ""; });
+    }, "Parameter mutrate must be above 0.015 in line 2 of file table.txt");
+
+    // Whole column failing a check
+    tst::checkError([&]() {
+        table.getcolumn<double>("mutrate", mutrate, nullptr, [](const std::vector<double> &x) { return x.size() < 3u ? "must have at least three rows" : ""; });
+    }, "Parameter mutrate must have at least three rows in file table.txt");
+
+    // Missing column
+    tst::checkError([&]() { table.getcolumn("seed"); }, "Missing parameter seed in file table.txt");
+
+    // Values where the header should be
+    tst::write("table.txt", "# Runs\n0.01 100\n0.02 200");
+    tst::checkError([&]() { table.load("table.txt"); }, "Invalid parameter: 0.01 in line 2 of file table.txt");
+
+    // Blank header
+    tst::write("table.txt", "  \t\nmutrate popsize\n0.01 100");
+    tst::checkError([&]() { table.load("table.txt"); }, "Could not read parameter name in line 1 of file table.txt");
+
+    // No header at all
+    tst::write("table.txt", "# Runs\n");
+    tst::checkError([&]() { table.load("table.txt"); }, "Missing parameter names in file table.txt");
+
+    // Duplicate name
+    tst::write("table.txt", "mutrate mutrate\n0.01 0.02");
+    tst::checkError([&]() { table.load("table.txt"); }, "Invalid parameter: mutrate in line 1 of file table.txt");
+
+    // Remove the file
+    std::remove("table.txt");
+
+}
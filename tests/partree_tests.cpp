@@ -0,0 +1,87 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test hierarchical parameter names
+
+#include "testutils.hpp"
+#include "../src/partree.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test listing and reading parameters by group
+BOOST_AUTO_TEST_CASE(treeScopes) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "pop.size 100\npop.growth 1.1\nenv.temp.mean 15\nenv.temp.sd 2\nenv.temp-x 1\nenv.rain 3\nseed 42");
+
+    // Load it
+    ParSet pars;
+    pars.load("parameters.txt");
+
+    // Organize it
+    ParTree tree(pars);
+
+    // Check the groups
+    BOOST_CHECK(tree.has("env.temp.mean"));
+    BOOST_CHECK(!tree.has("env.temp"));
+    BOOST_CHECK(tree.getgroups() == std::vector<std::string>({ "env", "pop" }));
+
+    // Take a scope
+    ParTree env = tree.getscope("env");
+
+    // Check what it contains (group by group)
+    BOOST_CHECK(env.getnames() == std::vector<std::string>({ "rain", "temp.mean", "temp.sd", "temp-x" }));
+    BOOST_CHECK_EQUAL(env.getprefix(), "env.");
+
+    // Read from a nested scope
+    double mean;
+    tree.getscope("env").getscope("temp").getvalue<double>("mean", mean);
+    BOOST_CHECK_EQUAL(mean, 15.0);
+
+    // Or with the full name
+    size_t popsize;
+    tree.getvalue<size_t>("pop.size", popsize);
+    BOOST_CHECK_EQUAL(popsize, 100u);
+
+    // Errors give the full name
+    tst::checkError([&]() { env.getvalue<double>("wind", mean); }, "Missing parameter env.wind in file parameters.txt");
+    tst::checkError([&]() { tree.getscope("seed"); }, "Missing group seed in file parameters.txt");
+    tst::checkError([&]() { env.getscope("snow"); }, "Missing group env.snow in file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that values are found through the tree
+BOOST_AUTO_TEST_CASE(treeLookups) {
+
+    // Write a parameter file with a repeated name
+    tst::write("parameters.txt", "env.temp 10\npop.size 100\nenv.temp 12\nenv.rain 1 2 3");
+
+    // Load and organize it
+    ParSet pars;
+    pars.load("parameters.txt");
+    ParTree tree(pars);
+    ParTree env = tree.getscope("env");
+
+    // The last occurrence wins, as in the set
+    double temp;
+    env.getvalue<double>("temp", temp);
+    BOOST_CHECK_EQUAL(temp, 12.0);
+
+    // Vectors too
+    std::vector<int> rain;
+    env.getvalues<int>("rain", rain, 3u);
+    BOOST_CHECK_EQUAL(rain[2u], 3);
+
+    // Errors come from the line of the parameter
+    tst::checkError([&]() { env.getvalue<double>("temp", temp, [](const double &x) { return x < 11.0 ? "" : "must be below 11"; }); }, "Parameter env.temp must be below 11 in line 3 of file parameters.txt");
+    tst::checkError([&]() { env.getvalues<int>("rain", rain, 2u); }, "Too many values for parameter env.rain in line 4 of file parameters.txt");
+
+    // Groups are not parameters
+    tst::checkError([&]() { tree.getvalue<double>("env", temp); }, "Missing parameter env in file parameters.txt");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
@@ -0,0 +1,266 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test that reading does not get slower or allocate more
+
+// Note: Timings depend on the machine, so the time taken by the reader is
+// compared to the time taken by a plain loop doing the bare minimum on the
+// same text (finding lines, or splitting words and converting numbers), and
+// this ratio is compared to the baseline in perf_baseline.txt, within the
+// tolerance given there. Timings of unoptimized builds say little about the
+// code, so only optimized builds check them. Allocations do not depend on the
+// machine or the build, and may not go up at all. To
+// update the baseline after a deliberate change, run the tests with the
+// environment variable READPARS_PERF_UPDATE set.
+
+#include "testutils.hpp"
+#include "../src/readpars.hpp"
+#include "../src/parcorpus.hpp"
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+// Number of memory allocations made so far (counted in perfallocs.cpp)
+extern std::atomic<size_t> nallocs;
+
+namespace {
+
+    // Baseline file (its path is given when building, see CMakeLists.txt)
+#ifdef READPARS_PERF_BASELINE
+    const std::string baseline = READPARS_PERF_BASELINE;
+#else
+    const std::string baseline = "tests/perf_baseline.txt";
+#endif
+
+    // Whether timings are checked (optimized builds only)
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && defined(NDEBUG))
+    const bool timed = true;
+#else
+    const bool timed = false;
+#endif
+
+    // Something to keep the compiler from optimizing reads away
+    double sink = 0.0;
+
+    // Function to read the baseline
+    std::vector<std::pair<std::string, double>> load() {
+
+        // Prepare
+        std::vector<std::pair<std::string, double>> entries;
+
+        // The baseline is a parameter file
+        ReadPars reader(baseline);
+        reader.open();
+        while (!reader.iseof()) {
+            reader.readline();
+            if (reader.isempty() || reader.iscomment()) continue;
+            double x;
+            reader.readvalue(x);
+            entries.push_back({ reader.getname(), x });
+        }
+        reader.close();
+
+        return entries;
+
+    }
+
+    // Function to find an entry of the baseline
+    bool find(const std::vector<std::pair<std::string, double>> &entries, const std::string &name, double &x) {
+
+        // entries: entries of the baseline
+        // name: name of the entry
+        // x: value of the entry (output)
+
+        for (const auto &[key, value] : entries)
+            if (key == name) { x = value; return true; }
+
+        return false;
+
+    }
+
+    // Function to update entries of the baseline
+    void update(const std::vector<std::pair<std::string, double>> &changes) {
+
+        // changes: entries to add or replace
+
+        // Current content
+        std::vector<std::pair<std::string, double>> entries = load();
+
+        // Change it
+        for (const auto &[name, value] : changes) {
+            auto it = std::find_if(entries.begin(), entries.end(), [&](const auto &e) { return e.first == name; });
+            if (it != entries.end()) it->second = value;
+            else entries.push_back({ name, value });
+        }
+
+        // Write it back
+        std::string text = "# Baseline of the performance tests (see perf_tests.cpp)\n";
+        text += "# Ratios depend on the machine where they were recorded (see doc/TESTS.md)\n";
+        char buffer[64];
+        for (const auto &[name, value] : entries) {
+            const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof buffer, value, std::chars_format::general, 4);
+            text += name + " " + std::string(buffer, result.ptr) + "\n";
+        }
+        tst::write(baseline, text);
+
+    }
+
+    // Function to time the best of several runs
+    template <typename F>
+    double best(const F &run) {
+
+        // run: function to time
+
+        double t = 1e300;
+        for (size_t r = 0u; r < 11u; ++r) {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+            t = std::min(t, time.count());
+        }
+
+        return t;
+
+    }
+
+    // Function to count the allocations of a single run
+    template <typename F>
+    size_t count(const F &run) {
+
+        // run: function to check
+
+        const size_t before = nallocs;
+        run();
+        return nallocs - before;
+
+    }
+
+    // Function to compare results with the baseline
+    void check(const std::string &name, const double &ratio, const double &allocs) {
+
+        // name: name of the workload
+        // ratio: time of the reader relative to the plain loop
+        // allocs: allocations per line or per value
+
+        // If requested, save instead
+        if (std::getenv("READPARS_PERF_UPDATE")) {
+            if (timed) update({ { name + ".allocs", allocs }, { name + ".ratio", ratio } });
+            else update({ { name + ".allocs", allocs } });
+            return;
+        }
+
+        // Baseline
+        const std::vector<std::pair<std::string, double>> entries = load();
+        double tolerance = 0.5, expected;
+        find(entries, "tolerance", tolerance);
+
+        // Allocations may not go up
+        BOOST_REQUIRE(find(entries, name + ".allocs", expected));
+        BOOST_TEST_MESSAGE(name << ": " << allocs << " allocations per item (baseline " << expected << ")");
+        BOOST_CHECK_LE(allocs, expected * 1.001 + 1e-9);
+
+        // Time may not go up beyond the tolerance
+        if (!timed) {
+            BOOST_TEST_MESSAGE(name << ": unoptimized build, timing not checked");
+            return;
+        }
+        BOOST_REQUIRE(find(entries, name + ".ratio", expected));
+        BOOST_TEST_MESSAGE(name << ": " << ratio << " times the plain loop (baseline " << expected << ")");
+        BOOST_CHECK_LE(ratio, expected * (1.0 + tolerance));
+
+    }
+}
+
+// Test that reading lines does not get slower or allocate more
+BOOST_AUTO_TEST_CASE(perfReadline) {
+
+    // Fixed workload
+    ParCorpus::Shape shape;
+    shape.nparams = 200000u;
+    shape.vectors = 0.0;
+    const std::string text = ParCorpus(shape).generate();
+
+    // Reading lines with the reader
+    size_t nlines = 0u;
+    auto reader = [&] {
+        ReadPars r("corpus.txt");
+        r.open(text);
+        while (!r.iseof()) r.readline();
+        nlines = r.getcount();
+    };
+
+    // Finding lines and names by hand
+    auto plain = [&] {
+        size_t n = 0u;
+        for (const char *p = text.data(), *end = p + text.size(); p < end; ++n) {
+            const char *eol = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (!eol) eol = end;
+            const char *space = static_cast<const char*>(std::memchr(p, ' ', eol - p));
+            sink += space ? space - p : 0;
+            p = eol + 1;
+        }
+        sink += n;
+    };
+
+    // Compare
+    const double ratio = best(reader) / best(plain);
+    const double allocs = static_cast<double>(count(reader)) / nlines;
+    check("readline", ratio, allocs);
+
+}
+
+// Test that reading values does not get slower or allocate more
+BOOST_AUTO_TEST_CASE(perfReadvalues) {
+
+    // Fixed workload
+    ParCorpus::Shape shape;
+    shape.nparams = 5000u;
+    shape.vectors = 1.0;
+    shape.maxlength = 200u;
+    shape.comments = 0.0;
+    shape.blanks = 0.0;
+    const std::string text = ParCorpus(shape).generate();
+
+    // Number of values on each line (not timed)
+    std::vector<size_t> lengths;
+    std::vector<double> values;
+    ReadPars scan("corpus.txt");
+    scan.open(text);
+    while (!scan.iseof()) { scan.readline(); scan.readall(values); lengths.push_back(values.size()); }
+    size_t nvalues = 0u;
+    for (const size_t &n : lengths) nvalues += n;
+
+    // Reading values with the reader
+    auto reader = [&] {
+        ReadPars r("corpus.txt");
+        r.open(text);
+        for (const size_t &n : lengths) { r.readline(); r.readvalues<double>(values, n); }
+        sink += values.back();
+    };
+
+    // Splitting words and converting them by hand
+    auto plain = [&] {
+        const char *p = text.data(), *end = p + text.size();
+        while (p < end) {
+            while (p < end && *p != ' ' && *p != '\n') ++p;
+            while (p < end && *p == ' ') {
+                const char *start = ++p;
+                while (p < end && *p != ' ' && *p != '\n') ++p;
+                double x;
+                std::from_chars(start, p, x);
+                sink += x;
+            }
+            ++p;
+        }
+    };
+
+    // Compare
+    const double ratio = best(reader) / best(plain);
+    const double allocs = static_cast<double>(count(reader)) / nvalues;
+    check("readvalues", ratio, allocs);
+
+}
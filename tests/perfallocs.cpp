@@ -0,0 +1,59 @@
+// Replacement of the global allocation functions for the performance tests,
+// counting every memory allocation.
+
+// Note: These are in their own source file so the compiler cannot inline
+// them into the code allocating and releasing memory, where it would take
+// the release of memory from operator new with free() for a mismatch.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Number of memory allocations made so far
+std::atomic<size_t> nallocs(0u);
+
+// Count an allocation (with the given alignment, or none)
+static void* allocate(size_t size, size_t align = 0u) noexcept {
+    ++nallocs;
+    if (size == 0u) size = 1u;
+    if (align == 0u) return std::malloc(size);
+    return std::aligned_alloc(align, (size + align - 1u) / align * align);
+}
+
+// Count every allocation (every form is replaced, so each one is released
+// by the matching form below, and both end up in malloc and free)
+void* operator new(size_t size) {
+    if (void *p = allocate(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+    if (void *p = allocate(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align) {
+    if (void *p = allocate(size, static_cast<size_t>(align))) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size, std::align_val_t align) {
+    if (void *p = allocate(size, static_cast<size_t>(align))) return p;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return allocate(size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return allocate(size, static_cast<size_t>(align)); }
+
+// Release (sized or not, aligned or not)
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void *p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void *p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
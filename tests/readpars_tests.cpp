@@ -403,6 +403,45 @@ BOOST_AUTO_TEST_CASE(readerErrorParseValue) {
 
 }
 
+// Test that numbers are parsed as they were with streams
+BOOST_AUTO_TEST_CASE(readerParseNumbers) {
+
+    // Prepare
+    double x = 1.0;
+
+    // Valid numbers
+    BOOST_CHECK(ReadPars::parse("-12.5e3", x));
+    BOOST_CHECK_EQUAL(x, -12500.0);
+    BOOST_CHECK(ReadPars::parse(".5", x));
+    BOOST_CHECK_EQUAL(x, 0.5);
+    BOOST_CHECK(ReadPars::parse("5.", x));
+    BOOST_CHECK_EQUAL(x, 5.0);
+    BOOST_CHECK(ReadPars::parse("2e+3", x));
+    BOOST_CHECK_EQUAL(x, 2000.0);
+
+    // Numbers too small are zero
+    BOOST_CHECK(ReadPars::parse("1e-400", x));
+    BOOST_CHECK_EQUAL(x, 0.0);
+    BOOST_CHECK(ReadPars::parse("-0.00001e-320", x));
+    BOOST_CHECK_EQUAL(x, 0.0);
+    BOOST_CHECK(ReadPars::parse("-1e-400", x));
+    BOOST_CHECK_EQUAL(x, 0.0);
+
+    // Numbers too large, infinity, not-a-number and leftovers are not allowed
+    BOOST_CHECK(!ReadPars::parse("1e400", x));
+    BOOST_CHECK(!ReadPars::parse("1e+400", x));
+    BOOST_CHECK(!ReadPars::parse("-1e+400", x));
+    BOOST_CHECK(!ReadPars::parse("-100000e305", x));
+    BOOST_CHECK(!ReadPars::parse("inf", x));
+    BOOST_CHECK(!ReadPars::parse("-infinity", x));
+    BOOST_CHECK(!ReadPars::parse("nan", x));
+    BOOST_CHECK(!ReadPars::parse("1e", x));
+    BOOST_CHECK(!ReadPars::parse("1.2.3", x));
+    BOOST_CHECK(!ReadPars::parse("0x10", x));
+    BOOST_CHECK(!ReadPars::parse("", x));
+
+}
+
 // Test that reading a vector of values works
 BOOST_AUTO_TEST_CASE(readerReadVector) {
 
@@ -583,3 +622,203 @@ BOOST_AUTO_TEST_CASE(checkerError) {
     std::remove("parameters.txt");
  
 }
+
+// Test that strings can be read
+BOOST_AUTO_TEST_CASE(readerReadStrings) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "model neutral\nsteps mutation selection drift");
+
+    // Create a reader
+    ReadPars reader("parameters.txt");
+
+    // Open the file
+    reader.open();
+
+    // Read a single string
+    reader.readline();
+    std::string model;
+    reader.readvalue<std::string>(model);
+
+    // Read a vector of strings
+    reader.readline();
+    std::vector<std::string> steps;
+    reader.readvalues<std::string>(steps, 3u);
+
+    // Check
+    BOOST_CHECK_EQUAL(model, "neutral");
+    BOOST_CHECK_EQUAL(steps[2u], "drift");
+
+    // Close the file
+    reader.close();
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that a schema catches duplicate parameters
+BOOST_AUTO_TEST_CASE(readerSchemaDuplicate) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "popsize 10\nmutrate 0.01\npopsize 20");
+
+    // Expected parameters
+    ParSchema schema;
+    schema.add("popsize");
+    schema.add("mutrate");
+
+    // Create a reader
+    ReadPars reader("parameters.txt");
+    reader.setschema(schema);
+    reader.open();
+
+    // Read the first two lines
+    reader.readline();
+    BOOST_CHECK_EQUAL(reader.getid(), 0u);
+    reader.readline();
+    BOOST_CHECK_EQUAL(reader.getid(), 1u);
+
+    // The third line repeats a parameter
+    tst::checkError([&]() { reader.readline(); }, "Duplicate parameter popsize in line 3 of file parameters.txt");
+
+    // Close the file
+    reader.close();
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that a schema finds missing and defaulted parameters
+BOOST_AUTO_TEST_CASE(readerSchemaMissing) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "popsize 10\nnoise 1\n");
+
+    // Expected parameters (more than one word of bits)
+    ParSchema schema;
+    schema.add("popsize");
+    for (int i = 0; i < 70; ++i) schema.add("extra" + std::to_string(i), { 0.0 });
+    schema.add("mutrate", { 0.01 });
+    schema.add("ngenes");
+
+    // Check
+    BOOST_CHECK(schema.isrequired(0u));
+    BOOST_CHECK(!schema.isrequired(71u));
+    BOOST_CHECK_EQUAL(schema.find("mutrate"), 71u);
+    BOOST_CHECK_EQUAL(schema.find("noise"), ParSchema::npos);
+
+    // Create a reader
+    ReadPars reader("parameters.txt");
+    reader.setschema(schema);
+    reader.open();
+
+    // Read the file
+    while (!reader.iseof()) {
+        reader.readline();
+        if (reader.isempty()) continue;
+        if (reader.getid() == ParSchema::npos) BOOST_CHECK_EQUAL(reader.getname(), "noise");
+    }
+
+    // Close the file
+    reader.close();
+
+    // Check
+    BOOST_CHECK(reader.isseen(0u));
+    tst::checkError([&]() { reader.checkmissing(); }, "Missing parameter ngenes in file parameters.txt");
+
+    // All the optional parameters were left to their defaults
+    const std::vector<size_t> defaulted = reader.getdefaulted();
+    BOOST_CHECK_EQUAL(defaulted.size(), 71u);
+    BOOST_CHECK_EQUAL(defaulted.back(), 71u);
+    BOOST_CHECK_EQUAL(schema.getdefault(defaulted.back())[0u], 0.01);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test switching on the ids of parameters
+BOOST_AUTO_TEST_CASE(readerSchemaSwitch) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "mutrate 0.01\n# Comment\npopsize 10\nnoise 1");
+
+    // Expected parameters, in the order of their ids
+    enum { POPSIZE, MUTRATE };
+    ParSchema schema({ "popsize", "mutrate" });
+
+    // Many more, to fill the table
+    for (int i = 0; i < 1000; ++i) schema.add("extra" + std::to_string(i), { 0.0 });
+
+    // Check
+    BOOST_CHECK_EQUAL(schema.find("extra999"), 1001u);
+    BOOST_CHECK_EQUAL(schema.find("extra1000"), ParSchema::npos);
+    tst::checkError([&]() { schema.add("popsize"); }, "Parameter popsize registered twice");
+
+    // Create a reader
+    ReadPars reader("parameters.txt");
+    reader.setschema(schema);
+    reader.open();
+
+    // Prepare to read parameters
+    size_t popsize = 0u;
+    double mutrate = 0.0;
+    size_t unknown = 0u;
+
+    // For each line...
+    while (!reader.iseof()) {
+
+        // Read it and dispatch on the id
+        switch (reader.readline()) {
+            case POPSIZE: reader.readvalue<size_t>(popsize); break;
+            case MUTRATE: reader.readvalue<double>(mutrate); break;
+            default: if (!reader.isempty() && !reader.iscomment()) ++unknown;
+        }
+    }
+
+    // Close the file
+    reader.close();
+
+    // Check
+    BOOST_CHECK_EQUAL(popsize, 10u);
+    BOOST_CHECK_EQUAL(mutrate, 0.01);
+    BOOST_CHECK_EQUAL(unknown, 1u);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Check error triggered by numbers out of range of the requested integer type
+BOOST_AUTO_TEST_CASE(readerErrorIntegerOutOfRange) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "nloci 1e30\nseed 9223372036854775808\nngenes 3e9");
+
+    // Create a reader
+    ReadPars reader("parameters.txt");
+
+    // Open the file
+    reader.open();
+
+    // Empty containers
+    int64_t nloci, seed;
+    int ngenes;
+
+    // Check that each line throws an error
+    reader.readline();
+    tst::checkError([&]() { reader.readvalue<int64_t>(nloci); }, "Invalid value type for parameter nloci in line 1 of file parameters.txt");
+    reader.readline();
+    tst::checkError([&]() { reader.readvalue<int64_t>(seed); }, "Invalid value type for parameter seed in line 2 of file parameters.txt");
+    reader.readline();
+    tst::checkError([&]() { reader.readvalue<int>(ngenes); }, "Invalid value type for parameter ngenes in line 3 of file parameters.txt");
+
+    // Close the file
+    reader.close();
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
@@ -0,0 +1,136 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test parameters changing over time
+
+#include "testutils.hpp"
+#include "../src/schedule.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test linear and step schedules
+BOOST_AUTO_TEST_CASE(scheduleRead) {
+
+    // Write a parameter file
+    tst::write("parameters.txt", "temperature schedule 0:10 500:12 1000:15\nharvest schedule step 100:0 200:1 300:0");
+
+    // Create a reader
+    ReadPars reader("parameters.txt");
+    reader.open();
+
+    // Read the schedules
+    Schedule temperature, harvest;
+    reader.readline();
+    temperature.read(reader);
+    reader.readline();
+    harvest.read(reader);
+
+    // Close the file
+    reader.close();
+
+    // Check the interpolated values
+    BOOST_CHECK_EQUAL(temperature.getvalue(0u), 10.0);
+    BOOST_CHECK_CLOSE(temperature.getvalue(250u), 11.0, 1e-9);
+    BOOST_CHECK_CLOSE(temperature.getvalue(750u), 13.5, 1e-9);
+    BOOST_CHECK_EQUAL(temperature.getvalue(1000u), 15.0);
+    BOOST_CHECK_EQUAL(temperature.getvalue(5000u), 15.0);
+
+    // Check the steps
+    BOOST_CHECK_EQUAL(harvest.getmode(), Schedule::Step);
+    BOOST_CHECK_EQUAL(harvest.getstart(), 100u);
+    BOOST_CHECK_EQUAL(harvest.getend(), 300u);
+    BOOST_CHECK_EQUAL(harvest.getvalue(50u), 0.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(199u), 0.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(200u), 1.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(299u), 1.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(300u), 0.0);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test schedules too long to be tabled
+BOOST_AUTO_TEST_CASE(scheduleLong) {
+
+    // Write a parameter file (one linear and one step schedule over a
+    // huge span, and a short one to compare with)
+    tst::write("parameters.txt", "temperature schedule 0:10 1e18:20\nharvest schedule step 10:0 1e12:1 2e12:0\nshort schedule 0:10 1000:20");
+
+    // Read them
+    ReadPars reader("parameters.txt");
+    reader.open();
+    Schedule temperature, harvest, tabled;
+    reader.readline();
+    temperature.read(reader);
+    reader.readline();
+    harvest.read(reader);
+    reader.readline();
+    tabled.read(reader);
+    reader.close();
+
+    // Check the interpolated values
+    BOOST_CHECK_EQUAL(temperature.getend(), 1000000000000000000u);
+    BOOST_CHECK_EQUAL(temperature.getvalue(0u), 10.0);
+    BOOST_CHECK_CLOSE(temperature.getvalue(500000000000000000u), 15.0, 1e-9);
+    BOOST_CHECK_EQUAL(temperature.getvalue(2000000000000000000u), 20.0);
+
+    // Check the steps
+    BOOST_CHECK_EQUAL(harvest.getvalue(5u), 0.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(999999999999u), 0.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(1000000000000u), 1.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(1999999999999u), 1.0);
+    BOOST_CHECK_EQUAL(harvest.getvalue(2000000000000u), 0.0);
+
+    // Searching the breakpoints gives the same values as the table
+    Schedule searched;
+    searched.set({ 0u, 1u << 21u }, { 10.0, 20.0 });
+    tabled.set({ 0u, 1u << 19u }, { 10.0, 20.0 });
+    for (size_t t = 0u; t <= (1u << 19u); t += 997u)
+        BOOST_CHECK_EQUAL(searched.getvalue(4u * t), tabled.getvalue(t));
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test errors in schedules
+BOOST_AUTO_TEST_CASE(scheduleErrors) {
+
+    // Prepare
+    Schedule schedule;
+
+    // Function to read the first line of a file into the schedule
+    auto read = [&]() {
+        ReadPars reader("parameters.txt");
+        reader.open();
+        reader.readline();
+        schedule.read(reader);
+    };
+
+    // Error message
+    const std::string error = "Invalid schedule for parameter temperature in line 1 of file parameters.txt";
+
+    // Times not in order
+    tst::write("parameters.txt", "temperature schedule 0:10 500:12 400:15");
+    tst::checkError(read, error);
+
+    // Negative time
+    tst::write("parameters.txt", "temperature schedule -1:10");
+    tst::checkError(read, error);
+
+    // Missing value
+    tst::write("parameters.txt", "temperature schedule 0:10 500");
+    tst::checkError(read, error);
+
+    // Not a schedule
+    tst::write("parameters.txt", "temperature 10");
+    tst::checkError(read, error);
+
+    // Time beyond the largest integer
+    tst::write("parameters.txt", "temperature schedule 0:10 1e20:15");
+    tst::checkError(read, error);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
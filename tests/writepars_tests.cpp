@@ -0,0 +1,156 @@
+#define BOOST_TEST_DYNAMIC_LINK
+#define BOOST_TEST_MODULE Main
+
+// Here we test the writing of parameter files
+
+#include "testutils.hpp"
+#include "../src/writepars.hpp"
+#include <boost/test/unit_test.hpp>
+
+// Test that values are written in their shortest form
+BOOST_AUTO_TEST_CASE(writerWriteValues) {
+
+    // Create a writer
+    WritePars writer("parameters.txt");
+
+    // Open the file
+    writer.open();
+
+    // Write parameters
+    writer.writecomment("Saved parameters");
+    writer.writevalue<int>("ngenes", 4);
+    writer.writevalue<double>("mutrate", 0.01);
+    writer.writevalue<bool>("verbose", true);
+    writer.writevalues<double>("genes", { 1.0, -1.25, 1e20, 1.5e-7, 0.1 });
+
+    // Check elements
+    BOOST_CHECK_EQUAL(writer.getcount(), 5u);
+
+    // Close the file
+    writer.close();
+
+    // Check the content
+    BOOST_CHECK_EQUAL(tst::readtext("parameters.txt"), "# Saved parameters\nngenes 4\nmutrate 0.01\nverbose 1\ngenes 1 -1.25 1e20 1.5e-07 0.1\n");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that writing and reading back gives the same file
+BOOST_AUTO_TEST_CASE(writerRoundTrip) {
+
+    // Values that are hard to write exactly
+    std::vector<double> values = { 0.1 + 0.2, 1.0 / 3.0, -2.2250738585072014e-308, 1.7976931348623157e308, 123456789.123456789, -0.0 };
+
+    // Write them
+    WritePars writer("parameters1.txt");
+    writer.open();
+    writer.writevalues<double>("values", values);
+    writer.writevalue<size_t>("popsize", 18446744073709549568u);
+    writer.close();
+
+    // Read them back
+    ReadPars reader("parameters1.txt");
+    reader.open();
+    reader.readline();
+    std::vector<double> read;
+    reader.readvalues<double>(read, values.size());
+    reader.close();
+
+    // Check that the values are exactly the same
+    for (size_t i = 0u; i < values.size(); ++i)
+        BOOST_CHECK_EQUAL(std::memcmp(&read[i], &values[i], sizeof(double)), 0);
+
+    // Load the file and write it again
+    ParSet pars;
+    pars.load("parameters1.txt");
+    WritePars rewriter("parameters2.txt");
+    rewriter.open();
+    rewriter.writeset(pars);
+    rewriter.close();
+
+    // Check that both files are identical
+    BOOST_CHECK_EQUAL(tst::readtext("parameters1.txt"), tst::readtext("parameters2.txt"));
+
+    // Remove the files
+    std::remove("parameters1.txt");
+    std::remove("parameters2.txt");
+
+}
+
+// Test that large integers are read back exactly
+BOOST_AUTO_TEST_CASE(writerRoundTripIntegers) {
+
+    // Integers that doubles cannot hold exactly
+    const int64_t a = (int64_t(1) << 53) + 1;
+    const int64_t b = std::numeric_limits<int64_t>::max();
+    const int64_t c = std::numeric_limits<int64_t>::min();
+    const uint64_t d = std::numeric_limits<uint64_t>::max();
+
+    // Write them
+    WritePars writer("parameters.txt");
+    writer.open();
+    writer.writevalue<int64_t>("a", a);
+    writer.writevalues<int64_t>("bc", { b, c });
+    writer.writevalue<uint64_t>("d", d);
+    writer.close();
+
+    // Read them back
+    ReadPars reader("parameters.txt");
+    reader.open();
+    int64_t x;
+    std::vector<int64_t> y;
+    uint64_t z;
+    reader.readline();
+    reader.readvalue<int64_t>(x);
+    reader.readline();
+    reader.readvalues<int64_t>(y, 2u);
+    reader.readline();
+    reader.readvalue<uint64_t>(z);
+    reader.close();
+
+    // Check that they are exactly the same
+    BOOST_CHECK_EQUAL(x, a);
+    BOOST_CHECK_EQUAL(y[0u], b);
+    BOOST_CHECK_EQUAL(y[1u], c);
+    BOOST_CHECK_EQUAL(z, d);
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that values that could not be read back are rejected
+BOOST_AUTO_TEST_CASE(writerErrors) {
+
+    // Create a writer
+    WritePars writer("parameters.txt");
+    writer.open();
+
+    // Check errors
+    tst::checkError([&]() { writer.writevalue<double>("mutrate", std::nan("")); }, "Invalid value for parameter mutrate in line 1 of file parameters.txt");
+    tst::checkError([&]() { writer.writevalue<double>("mut rate", 0.1); }, "Invalid parameter name mut rate in line 1 of file parameters.txt");
+    tst::checkError([&]() { writer.writevalues<double>("mutrate", {}); }, "Invalid value for parameter mutrate in line 1 of file parameters.txt");
+
+    // Close the file
+    writer.close();
+
+    // Check that nothing was written
+    BOOST_CHECK_EQUAL(tst::readtext("parameters.txt"), "");
+
+    // Remove the file
+    std::remove("parameters.txt");
+
+}
+
+// Test that a writer cannot open a file in a missing folder
+BOOST_AUTO_TEST_CASE(writerErrorOpenFile) {
+
+    // Create a writer
+    WritePars writer("nonexistent/parameters.txt");
+
+    // Check error
+    tst::checkError([&]() { writer.open(); }, "Unable to open file nonexistent/parameters.txt");
+
+}
@@ -0,0 +1,108 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// This is the readpars-corpus tool, which generates synthetic parameter
+// files (see src/parcorpus.hpp). Usage:
+//
+//   readpars-corpus output.txt [--option value ...]
+//
+// with options --nparams, --vectors, --maxlength, --comments, --blanks,
+// --integers, --exponents, --mantissas, --errors and --seed (see the shape
+// of the files in src/parcorpus.hpp), and --files, to write that many files
+// (output_1.txt, output_2.txt...) with consecutive seeds. The lines where
+// errors were injected, if any, are listed on the standard output.
+
+#include "../src/parcorpus.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+// Main function
+int main(int argc, char *argv[]) {
+
+    // Check the arguments
+    if (argc < 2 || argc % 2 != 0) {
+        std::fprintf(stderr, "Usage: readpars-corpus output.txt [--option value ...]\n");
+        return 1;
+    }
+
+    // Try to...
+    try {
+
+        // Default shape
+        ParCorpus::Shape shape;
+        size_t nfiles = 0u;
+
+        // Read the options
+        for (int i = 2; i < argc; i += 2) {
+
+            // Option and value
+            const std::string option = argv[i];
+            const char *value = argv[i + 1];
+
+            // Set it
+            if (option == "--nparams") shape.nparams = std::strtoull(value, nullptr, 10);
+            else if (option == "--vectors") shape.vectors = std::atof(value);
+            else if (option == "--maxlength") shape.maxlength = std::strtoull(value, nullptr, 10);
+            else if (option == "--comments") shape.comments = std::atof(value);
+            else if (option == "--blanks") shape.blanks = std::atof(value);
+            else if (option == "--integers") shape.integers = std::atof(value);
+            else if (option == "--exponents") shape.exponents = std::atof(value);
+            else if (option == "--mantissas") shape.mantissas = std::atof(value);
+            else if (option == "--errors") shape.errors = std::atof(value);
+            else if (option == "--seed") shape.seed = std::strtoull(value, nullptr, 10);
+            else if (option == "--files") nfiles = std::strtoull(value, nullptr, 10);
+            else throw std::runtime_error("Unknown option " + option);
+
+        }
+
+        // Name of the output (with a number inserted if several files)
+        const std::string output = argv[1];
+        const size_t dot = output.rfind('.');
+        const std::string stem = dot == std::string::npos ? output : output.substr(0u, dot);
+        const std::string extension = dot == std::string::npos ? "" : output.substr(dot);
+
+        // For each file...
+        for (size_t k = 0u; k < std::max(nfiles, size_t(1u)); ++k) {
+
+            // Name of the file
+            const std::string filename = nfiles ? stem + "_" + std::to_string(k + 1u) + extension : output;
+
+            // Generate it
+            ParCorpus::Shape current = shape;
+            current.seed = shape.seed + k;
+            ParCorpus corpus(current);
+            corpus.write(filename);
+
+            // List the errors, if any
+            for (const size_t &line : corpus.geterrors())
+                std::printf("Error in line %zu of file %s\n", line, filename.c_str());
+
+        }
+
+        // Exit
+        return 0;
+
+    }
+    catch (const std::exception& err) {
+
+        // Catch exceptions
+        std::fprintf(stderr, "Exception: %s\n", err.what());
+
+    }
+
+    // Return failure flag if got here
+    return 1;
+
+}
@@ -0,0 +1,66 @@
+// ReadPars: Simple C++ library to read parameter text files
+
+// Copyright (c) 2025-2026, Raphaël Scherrer
+// This code is shared under the MIT License. You are free
+// to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of it, subject to the terms of the license.
+// You must retain the copyright notice and license text in copies
+// or substantial portions of the code. See LICENSE file for details.
+
+// URL: https://github.com/rscherrer/readpars
+
+// This is the readpars-gen tool, which generates a parser from a schema
+// file (see src/pargen.hpp). Usage:
+//
+//   readpars-gen schema.txt output.hpp [StructName]
+
+#include "../src/pargen.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+// Main function
+int main(int argc, char *argv[]) {
+
+    // Check the arguments
+    if (argc < 3 || argc > 4) {
+        std::cerr << "Usage: readpars-gen schema.txt output.hpp [StructName]\n";
+        return 1;
+    }
+
+    // Try to...
+    try {
+
+        // Generate the code
+        const std::string code = genparser(argv[1], argc == 4 ? argv[3] : "Parameters");
+
+        // Read what is already there, if anything
+        std::ifstream old(argv[2], std::ios::binary);
+        std::ostringstream content;
+        content << old.rdbuf();
+
+        // Note: The output is only written if it changed, so that code
+        // including it is not rebuilt for nothing.
+        if (old.is_open() && content.str() == code) return 0;
+
+        // Write it
+        std::ofstream file(argv[2], std::ios::binary);
+        if (!file.is_open()) throw std::runtime_error("Unable to open file " + std::string(argv[2]));
+        file << code;
+
+        // Exit
+        return 0;
+
+    }
+    catch (const std::exception& err) {
+
+        // Catch exceptions
+        std::cerr << "Exception: " << err.what() << '\n';
+
+    }
+
+    // Return failure flag if got here
+    return 1;
+
+}